@@ -28,142 +28,47 @@
 #endif
 
 // ---------------------------------------------------------------------------
-// font6x8
+// glyph expansion tables
 // ---------------------------------------------------------------------------
 
 namespace {
 
-const uint8_t font6x8[128][6] PROGMEM = {
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x00 NUL */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x01 SOH */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x02 STX */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x03 ETX */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x04 EOT */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x05 ENQ */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x06 ACK */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x07 BEL */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x08 BS  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x09 HT  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x0a LF  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x0b VT  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x0c FF  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x0d CR  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x0e SO  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x0f SI  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x10 DLE */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x11 DC1 */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x12 DC2 */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x13 DC3 */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x14 DC4 */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x15 NAK */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x16 SYN */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x17 ETB */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x18 CAN */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x19 EM  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x1a SUB */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x1b ESC */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x1c FS  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x1d GS  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x1e RS  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x1f US  */
-    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x20 SPC */
-    { 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00 }, /* 0x21 !   */
-    { 0x00, 0x07, 0x00, 0x07, 0x00, 0x00 }, /* 0x22 "   */
-    { 0x14, 0x7f, 0x14, 0x7f, 0x14, 0x00 }, /* 0x23 #   */
-    { 0x24, 0x2a, 0x7f, 0x2a, 0x12, 0x00 }, /* 0x24 $   */
-    { 0x23, 0x13, 0x08, 0x64, 0x62, 0x00 }, /* 0x25 %   */
-    { 0x36, 0x49, 0x55, 0x22, 0x50, 0x00 }, /* 0x26 &   */
-    { 0x00, 0x05, 0x03, 0x00, 0x00, 0x00 }, /* 0x27 '   */
-    { 0x00, 0x1c, 0x22, 0x41, 0x00, 0x00 }, /* 0x28 (   */
-    { 0x00, 0x41, 0x22, 0x1c, 0x00, 0x00 }, /* 0x29 )   */
-    { 0x14, 0x08, 0x3e, 0x08, 0x14, 0x00 }, /* 0x2a *   */
-    { 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00 }, /* 0x2b +   */
-    { 0x00, 0x50, 0x30, 0x00, 0x00, 0x00 }, /* 0x2c ,   */
-    { 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 }, /* 0x2d -   */
-    { 0x00, 0x60, 0x60, 0x00, 0x00, 0x00 }, /* 0x2e .   */
-    { 0x20, 0x10, 0x08, 0x04, 0x02, 0x00 }, /* 0x2f /   */
-    { 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00 }, /* 0x30 0   */
-    { 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00 }, /* 0x31 1   */
-    { 0x42, 0x61, 0x51, 0x49, 0x46, 0x00 }, /* 0x32 2   */
-    { 0x21, 0x41, 0x45, 0x4b, 0x31, 0x00 }, /* 0x33 3   */
-    { 0x18, 0x14, 0x12, 0x7f, 0x10, 0x00 }, /* 0x34 4   */
-    { 0x27, 0x45, 0x45, 0x45, 0x39, 0x00 }, /* 0x35 5   */
-    { 0x3c, 0x4a, 0x49, 0x49, 0x30, 0x00 }, /* 0x36 6   */
-    { 0x01, 0x71, 0x09, 0x05, 0x03, 0x00 }, /* 0x37 7   */
-    { 0x36, 0x49, 0x49, 0x49, 0x36, 0x00 }, /* 0x38 8   */
-    { 0x06, 0x49, 0x49, 0x29, 0x1e, 0x00 }, /* 0x39 9   */
-    { 0x00, 0x36, 0x36, 0x00, 0x00, 0x00 }, /* 0x3a :   */
-    { 0x00, 0x56, 0x36, 0x00, 0x00, 0x00 }, /* 0x3b ;   */
-    { 0x08, 0x14, 0x22, 0x41, 0x00, 0x00 }, /* 0x3c <   */
-    { 0x14, 0x14, 0x14, 0x14, 0x14, 0x00 }, /* 0x3d =   */
-    { 0x00, 0x41, 0x22, 0x14, 0x08, 0x00 }, /* 0x3e >   */
-    { 0x02, 0x01, 0x51, 0x09, 0x06, 0x00 }, /* 0x3f ?   */
-    { 0x32, 0x49, 0x79, 0x41, 0x3e, 0x00 }, /* 0x40 @   */
-    { 0x7e, 0x11, 0x11, 0x11, 0x7e, 0x00 }, /* 0x41 A   */
-    { 0x7f, 0x49, 0x49, 0x49, 0x36, 0x00 }, /* 0x42 B   */
-    { 0x3e, 0x41, 0x41, 0x41, 0x22, 0x00 }, /* 0x43 C   */
-    { 0x7f, 0x41, 0x41, 0x22, 0x1c, 0x00 }, /* 0x44 D   */
-    { 0x7f, 0x49, 0x49, 0x49, 0x41, 0x00 }, /* 0x45 E   */
-    { 0x7f, 0x09, 0x09, 0x09, 0x01, 0x00 }, /* 0x46 F   */
-    { 0x3e, 0x41, 0x49, 0x49, 0x7a, 0x00 }, /* 0x47 G   */
-    { 0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00 }, /* 0x48 H   */
-    { 0x00, 0x41, 0x7f, 0x41, 0x00, 0x00 }, /* 0x49 I   */
-    { 0x20, 0x40, 0x41, 0x3f, 0x01, 0x00 }, /* 0x4a J   */
-    { 0x7f, 0x08, 0x14, 0x22, 0x41, 0x00 }, /* 0x4b K   */
-    { 0x7f, 0x40, 0x40, 0x40, 0x40, 0x00 }, /* 0x4c L   */
-    { 0x7f, 0x02, 0x0c, 0x02, 0x7f, 0x00 }, /* 0x4d M   */
-    { 0x7f, 0x04, 0x08, 0x10, 0x7f, 0x00 }, /* 0x4e N   */
-    { 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00 }, /* 0x4f O   */
-    { 0x7f, 0x09, 0x09, 0x09, 0x06, 0x00 }, /* 0x50 P   */
-    { 0x3e, 0x41, 0x51, 0x21, 0x5e, 0x00 }, /* 0x51 Q   */
-    { 0x7f, 0x09, 0x19, 0x29, 0x46, 0x00 }, /* 0x52 R   */
-    { 0x46, 0x49, 0x49, 0x49, 0x31, 0x00 }, /* 0x53 S   */
-    { 0x01, 0x01, 0x7f, 0x01, 0x01, 0x00 }, /* 0x54 T   */
-    { 0x3f, 0x40, 0x40, 0x40, 0x3f, 0x00 }, /* 0x55 U   */
-    { 0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00 }, /* 0x56 V   */
-    { 0x3f, 0x40, 0x38, 0x40, 0x3f, 0x00 }, /* 0x57 W   */
-    { 0x63, 0x14, 0x08, 0x14, 0x63, 0x00 }, /* 0x58 X   */
-    { 0x07, 0x08, 0x70, 0x08, 0x07, 0x00 }, /* 0x59 Y   */
-    { 0x61, 0x51, 0x49, 0x45, 0x43, 0x00 }, /* 0x5a Z   */
-    { 0x00, 0x7f, 0x41, 0x41, 0x00, 0x00 }, /* 0x5b [   */
-    { 0x02, 0x04, 0x08, 0x10, 0x20, 0x00 }, /* 0x5c \   */
-    { 0x00, 0x41, 0x41, 0x7f, 0x00, 0x00 }, /* 0x5d ]   */
-    { 0x04, 0x02, 0x01, 0x02, 0x04, 0x00 }, /* 0x5e ^   */
-    { 0x40, 0x40, 0x40, 0x40, 0x40, 0x00 }, /* 0x5f _   */
-    { 0x00, 0x01, 0x02, 0x04, 0x00, 0x00 }, /* 0x60 `   */
-    { 0x20, 0x54, 0x54, 0x54, 0x78, 0x00 }, /* 0x61 a   */
-    { 0x7f, 0x48, 0x44, 0x44, 0x38, 0x00 }, /* 0x62 b   */
-    { 0x38, 0x44, 0x44, 0x44, 0x20, 0x00 }, /* 0x63 c   */
-    { 0x38, 0x44, 0x44, 0x48, 0x7f, 0x00 }, /* 0x64 d   */
-    { 0x38, 0x54, 0x54, 0x54, 0x18, 0x00 }, /* 0x65 e   */
-    { 0x08, 0x7e, 0x09, 0x01, 0x02, 0x00 }, /* 0x66 f   */
-    { 0x0c, 0x52, 0x52, 0x52, 0x3e, 0x00 }, /* 0x67 g   */
-    { 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00 }, /* 0x68 h   */
-    { 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00 }, /* 0x69 i   */
-    { 0x20, 0x40, 0x44, 0x3d, 0x00, 0x00 }, /* 0x6a j   */
-    { 0x7f, 0x10, 0x28, 0x44, 0x00, 0x00 }, /* 0x6b k   */
-    { 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00 }, /* 0x6c l   */
-    { 0x7c, 0x04, 0x18, 0x04, 0x78, 0x00 }, /* 0x6d m   */
-    { 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00 }, /* 0x6e n   */
-    { 0x38, 0x44, 0x44, 0x44, 0x38, 0x00 }, /* 0x6f o   */
-    { 0x7c, 0x14, 0x14, 0x14, 0x08, 0x00 }, /* 0x70 p   */
-    { 0x08, 0x14, 0x14, 0x18, 0x7c, 0x00 }, /* 0x71 q   */
-    { 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00 }, /* 0x72 r   */
-    { 0x48, 0x54, 0x54, 0x54, 0x20, 0x00 }, /* 0x73 s   */
-    { 0x04, 0x3f, 0x44, 0x40, 0x20, 0x00 }, /* 0x74 t   */
-    { 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00 }, /* 0x75 u   */
-    { 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00 }, /* 0x76 v   */
-    { 0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00 }, /* 0x77 w   */
-    { 0x44, 0x28, 0x10, 0x28, 0x44, 0x00 }, /* 0x78 x   */
-    { 0x0c, 0x50, 0x50, 0x50, 0x3c, 0x00 }, /* 0x79 y   */
-    { 0x44, 0x64, 0x54, 0x4c, 0x44, 0x00 }, /* 0x7a z   */
-    { 0x00, 0x08, 0x36, 0x41, 0x00, 0x00 }, /* 0x7b {   */
-    { 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00 }, /* 0x7c |   */
-    { 0x00, 0x41, 0x36, 0x08, 0x00, 0x00 }, /* 0x7d }   */
-    { 0x10, 0x08, 0x08, 0x10, 0x08, 0x00 }, /* 0x7e ~   */
-    { 0x7f, 0x55, 0x49, 0x55, 0x7f, 0x00 }  /* 0x7f     */
+const uint8_t expand2x[16] PROGMEM = {
+    0x00, 0x03, 0x0c, 0x0f, 0x30, 0x33, 0x3c, 0x3f,
+    0xc0, 0xc3, 0xcc, 0xcf, 0xf0, 0xf3, 0xfc, 0xff
 };
 
+const uint16_t expand3x[16] PROGMEM = {
+    0x000, 0x007, 0x038, 0x03f, 0x1c0, 0x1c7, 0x1f8, 0x1ff,
+    0xe00, 0xe07, 0xe38, 0xe3f, 0xfc0, 0xfc7, 0xff8, 0xfff
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// blitter
+// ---------------------------------------------------------------------------
+
+namespace {
+
+inline void blendByte(uint8_t& dst, const uint8_t src, const uint8_t mask, const uint8_t mode)
+{
+    switch(mode) {
+        case PCD8544_Traits::Blit::OR:
+            dst |= (src & mask);
+            break;
+        case PCD8544_Traits::Blit::AND_NOT:
+            dst &= ~(src & mask);
+            break;
+        case PCD8544_Traits::Blit::XOR:
+            dst ^= (src & mask);
+            break;
+        default:
+            dst = ((dst & ~mask) | (src & mask));
+            break;
+    }
+}
+
 }
 
 // ---------------------------------------------------------------------------
@@ -202,6 +107,11 @@ struct Command
         static constexpr uint8_t v_addressing  = 0b00000010;
         static constexpr uint8_t power_down    = 0b00000100;
 
+        static bool match(const uint8_t value)
+        {
+            return ((value & ~operand_mask) == instruction);
+        }
+
         static uint8_t command(const uint8_t operand_data)
         {
             return (instruction | (operand_data & operand_mask));
@@ -223,6 +133,11 @@ struct Command
         static constexpr uint8_t normal_mode   = 0b00000100;
         static constexpr uint8_t inverse_mode  = 0b00000101;
 
+        static bool match(const uint8_t value)
+        {
+            return ((value & ~operand_mask) == instruction);
+        }
+
         static uint8_t command(const uint8_t operand_data)
         {
             return (instruction | (operand_data & operand_mask));
@@ -242,6 +157,11 @@ struct Command
         static constexpr uint8_t min_row       = 0b00000000;
         static constexpr uint8_t max_row       = 0b00000101;
 
+        static bool match(const uint8_t value)
+        {
+            return ((value & ~operand_mask) == instruction);
+        }
+
         static uint8_t command(const uint8_t operand_data)
         {
             return (instruction | (operand_data & operand_mask));
@@ -261,6 +181,11 @@ struct Command
         static constexpr uint8_t min_col       = 0b00000000;
         static constexpr uint8_t max_col       = 0b01010011;
 
+        static bool match(const uint8_t value)
+        {
+            return ((value & ~operand_mask) == instruction);
+        }
+
         static uint8_t command(const uint8_t operand_data)
         {
             return (instruction | (operand_data & operand_mask));
@@ -282,6 +207,11 @@ struct Command
         static constexpr uint8_t tc2           = 0b00000010;
         static constexpr uint8_t tc3           = 0b00000011;
 
+        static bool match(const uint8_t value)
+        {
+            return ((value & ~operand_mask) == instruction);
+        }
+
         static uint8_t command(const uint8_t operand_data)
         {
             return (instruction | (operand_data & operand_mask));
@@ -307,6 +237,11 @@ struct Command
         static constexpr uint8_t n6            = 0b00000001;
         static constexpr uint8_t n7            = 0b00000000;
 
+        static bool match(const uint8_t value)
+        {
+            return ((value & ~operand_mask) == instruction);
+        }
+
         static uint8_t command(const uint8_t operand_data)
         {
             return (instruction | (operand_data & operand_mask));
@@ -324,6 +259,11 @@ struct Command
         static constexpr uint8_t operand_mask  = 0b01111111;
         static constexpr uint8_t default_value = 0b01000010;
 
+        static bool match(const uint8_t value)
+        {
+            return ((value & ~operand_mask) == instruction);
+        }
+
         static uint8_t command(const uint8_t operand_data)
         {
             return (instruction | (operand_data & operand_mask));
@@ -359,18 +299,106 @@ PCD8544::PCD8544 ( const uint8_t sclkPin
               , Traits::Initial::CURR_COL
               , Traits::Initial::WRAP_ROW
               , Traits::Initial::WRAP_COL }
+    , _text   { &PCD8544_Font6x8
+              , Traits::Font::MIN_SCALE
+              , false
+              , false }
+    , _escape { Traits::Escape::STATE_NONE
+              , 0
+              , {} }
+    , _state  { Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN }
+    , _startup { Traits::Startup::STEP_READY
+               , 0
+               , 0
+               , nullptr
+               , false }
+    , _frame  { nullptr
+              , nullptr
+              , false
+              , 0
+              , {}
+              , {} }
+    , _cells  { nullptr
+              , {}
+              , {} }
+#if PCD8544_STATS
+    , _stats  { 0, 0, 0, 0, 0, 0 }
+#endif
+    , _softTransport ( new PCD8544_SoftTransport ( sclkPin
+                                                 , dataPin
+                                                 , modePin
+                                                 , cselPin ) )
+    , _transport(*_softTransport)
+{
+}
+
+PCD8544::PCD8544 ( PCD8544_Transport& transport
+                 , const uint8_t      resetPin
+                 , const uint8_t      lightPin )
+    : _wiring { Traits::Setup::NO_PIN
+              , Traits::Setup::NO_PIN
+              , Traits::Setup::NO_PIN
+              , Traits::Setup::NO_PIN
+              , resetPin
+              , lightPin }
+    , _cursor { Traits::Initial::PREV_CHR
+              , Traits::Initial::CURR_ROW
+              , Traits::Initial::CURR_COL
+              , Traits::Initial::WRAP_ROW
+              , Traits::Initial::WRAP_COL }
+    , _text   { &PCD8544_Font6x8
+              , Traits::Font::MIN_SCALE
+              , false
+              , false }
+    , _escape { Traits::Escape::STATE_NONE
+              , 0
+              , {} }
+    , _state  { Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN
+              , Traits::Control::UNKNOWN }
+    , _startup { Traits::Startup::STEP_READY
+               , 0
+               , 0
+               , nullptr
+               , false }
+    , _frame  { nullptr
+              , nullptr
+              , false
+              , 0
+              , {}
+              , {} }
+    , _cells  { nullptr
+              , {}
+              , {} }
+#if PCD8544_STATS
+    , _stats  { 0, 0, 0, 0, 0, 0 }
+#endif
+    , _softTransport(nullptr)
+    , _transport(transport)
+{
+}
+
+PCD8544::~PCD8544()
 {
+    /* the bit-bang transport is owned only when built from the pins */ {
+        delete _softTransport;
+    }
 }
 
 void PCD8544::begin()
 {
     /* setup */ {
-        ::pinMode(_wiring.sclkPin , Traits::Setup::SCLK_PINMODE );
-        ::pinMode(_wiring.dataPin , Traits::Setup::DATA_PINMODE );
-        ::pinMode(_wiring.modePin , Traits::Setup::MODE_PINMODE );
-        ::pinMode(_wiring.cselPin , Traits::Setup::CSEL_PINMODE );
-        ::pinMode(_wiring.resetPin, Traits::Setup::RESET_PINMODE);
-        ::pinMode(_wiring.lightPin, Traits::Setup::LIGHT_PINMODE);
+        setup();
     }
     /* reset */ {
         reset();
@@ -379,32 +407,24 @@ void PCD8544::begin()
 
 void PCD8544::reset()
 {
-    /* reset cursor values */ {
-        _cursor.prev_chr = Traits::Initial::PREV_CHR;
-        _cursor.curr_row = Traits::Initial::CURR_ROW;
-        _cursor.curr_col = Traits::Initial::CURR_COL;
-        _cursor.wrap_row = Traits::Initial::WRAP_ROW;
-        _cursor.wrap_col = Traits::Initial::WRAP_COL;
-    }
-    /* initial signals state */ {
-        ::digitalWrite(_wiring.cselPin , 0x1);
-        ::digitalWrite(_wiring.resetPin, 0x1);
+    /* reset state */ {
+        resetState();
     }
     /* reset pulse (~100ms) */ {
-        ::digitalWrite(_wiring.resetPin, 0x0);
-        ::delay(100);
-        ::digitalWrite(_wiring.resetPin, 0x1);
+        if(_wiring.resetPin != Traits::Setup::NO_PIN) {
+            ::digitalWrite(_wiring.resetPin, 0x1);
+            ::digitalWrite(_wiring.resetPin, 0x0);
+            ::delay(100);
+            ::digitalWrite(_wiring.resetPin, 0x1);
+        }
     }
     /* configure controller */ {
-        setExtInstructionSet();
-        setTempCtrl(Command::TempCtrl::default_value);
-        setBiasSyst(Command::BiasSyst::default_value);
-        setVoltOper(Command::VoltOper::default_value);
-        setStdInstructionSet();
-        setNormalMode();
+        configure();
     }
     /* clear display */ {
         clearDisplay(0x00);
+        invalidate();
+        flush();
     }
 }
 
@@ -413,16 +433,144 @@ void PCD8544::end()
     /* power-down */ {
         setPowerDownMode();
     }
+    /* transport */ {
+        _transport.end();
+    }
+}
+
+void PCD8544::beginAsync(const uint8_t* splash, const bool pgm)
+{
+    /* setup */ {
+        setup();
+    }
+    /* reset state */ {
+        resetState();
+    }
+    /* start the reset pulse, poll() will end it */ {
+        if(_wiring.resetPin != Traits::Setup::NO_PIN) {
+            ::digitalWrite(_wiring.resetPin, 0x1);
+            ::digitalWrite(_wiring.resetPin, 0x0);
+        }
+    }
+    /* startup */ {
+        _startup.step   = Traits::Startup::STEP_RESET;
+        _startup.bank   = 0;
+        _startup.since  = ::micros();
+        _startup.splash = splash;
+        _startup.pgm    = pgm;
+    }
+}
+
+bool PCD8544::poll()
+{
+    switch(_startup.step) {
+        case Traits::Startup::STEP_RESET:
+            if((::micros() - _startup.since) < Traits::Startup::RESET_PULSE_US) {
+                break;
+            }
+            /* end of reset pulse */ {
+                if(_wiring.resetPin != Traits::Setup::NO_PIN) {
+                    ::digitalWrite(_wiring.resetPin, 0x1);
+                }
+            }
+            /* configure controller */ {
+                configure();
+                sendAddress(0, 0);
+            }
+            _startup.step = Traits::Startup::STEP_FILL;
+            break;
+        case Traits::Startup::STEP_FILL:
+            /* one bank per call, splash image or blank */ {
+                const uint16_t offset = (_startup.bank * Traits::Screen::MAX_COLS);
+                if(_startup.splash != nullptr) {
+                    sendDataBurst(&_startup.splash[offset], Traits::Screen::MAX_COLS, _startup.pgm);
+                }
+                else {
+                    fillData(0x00, Traits::Screen::MAX_COLS);
+                }
+            }
+            if(++_startup.bank < Traits::Screen::MAX_ROWS) {
+                break;
+            }
+            /* the frame buffer must be sent, the shadow now holds the display ram */ {
+                invalidate();
+                if(_frame.shadow != nullptr) {
+                    if(_startup.splash == nullptr) {
+                        ::memset(_frame.shadow, 0x00, Traits::Screen::BYTE_COUNT);
+                    }
+                    else if(_startup.pgm != false) {
+                        ::memcpy_P(_frame.shadow, _startup.splash, Traits::Screen::BYTE_COUNT);
+                    }
+                    else {
+                        ::memcpy(_frame.shadow, _startup.splash, Traits::Screen::BYTE_COUNT);
+                    }
+                    _frame.synced = true;
+                }
+            }
+            _startup.step = Traits::Startup::STEP_READY;
+            break;
+        default:
+            break;
+    }
+    return isReady();
+}
+
+bool PCD8544::isReady() const
+{
+    return (_startup.step == Traits::Startup::STEP_READY);
 }
 
 void PCD8544::setCursor(const uint8_t row, const uint8_t col)
 {
-    setRowAddressOfRam(row);
-    setColAddressOfRam(col);
+    moveCursorRow(row);
+    moveCursorCol(col);
+}
+
+void PCD8544::setFont(const PCD8544_Font& font)
+{
+    _text.font = &font;
+}
+
+const PCD8544_Font& PCD8544::getFont() const
+{
+    return *_text.font;
+}
+
+void PCD8544::setTextScale(const uint8_t scale)
+{
+    if(scale < Traits::Font::MIN_SCALE) {
+        _text.scale = Traits::Font::MIN_SCALE;
+    }
+    else if(scale > Traits::Font::MAX_SCALE) {
+        _text.scale = Traits::Font::MAX_SCALE;
+    }
+    else {
+        _text.scale = scale;
+    }
+}
+
+uint8_t PCD8544::getTextScale() const
+{
+    return _text.scale;
+}
+
+void PCD8544::setConsoleMode(const bool enabled)
+{
+    _text.console = enabled;
+}
+
+bool PCD8544::getConsoleMode() const
+{
+    return _text.console;
 }
 
 void PCD8544::setContrast(const uint8_t level)
 {
+    syncState();
+
+    if(_state.volt_oper == (Command::VoltOper::operand(level) & Command::VoltOper::operand_mask)) {
+        return;
+    }
     setExtInstructionSet();
     setVoltOper(level);
     setStdInstructionSet();
@@ -430,200 +578,779 @@ void PCD8544::setContrast(const uint8_t level)
 
 void PCD8544::setBacklight(const uint8_t level)
 {
+    if(_wiring.lightPin == Traits::Setup::NO_PIN) {
+        return;
+    }
     ::analogWrite(_wiring.lightPin, (0xff - level));
 }
 
 void PCD8544::clearDisplay(const uint8_t value)
 {
+    uint8_t fill = value;
+
+    /* the cells are blank, in reverse video for a black fill */ {
+        if(_cells.buffer != nullptr) {
+            fill = (value == 0xff ? 0xff : 0x00);
+            ::memset(_cells.buffer, Traits::Cells::BLANK, Traits::Cells::CELL_COUNT);
+            for(uint8_t line = 0; line < Traits::Cells::ROWS; ++line) {
+                _cells.dirty[line]   = 0x0000;
+                _cells.reverse[line] = (fill != 0x00 ? 0xffff : 0x0000);
+            }
+        }
+    }
     /* move to origin */ {
-        setRowAddressOfRam(0);
-        setColAddressOfRam(0);
+        moveCursorRow(0);
+        moveCursorCol(0);
     }
     /* send data */ {
-        uint16_t bytes = Traits::Screen::BYTE_COUNT;
-        do {
-            sendData(value);
-        } while(--bytes != 0);
+        if(_frame.buffer != nullptr) {
+            renderFill(0, fill, Traits::Screen::BYTE_COUNT);
+        }
+        else {
+            sendAddress(0, 0);
+            fillData(fill, Traits::Screen::BYTE_COUNT);
+        }
     }
 }
 
 void PCD8544::putImage(const uint8_t* image, const bool pgm)
 {
     /* move to origin */ {
-        setRowAddressOfRam(0);
-        setColAddressOfRam(0);
+        moveCursorRow(0);
+        moveCursorCol(0);
     }
     /* send data */ {
-        if(pgm != false) {
-            const uint8_t* bytes = image;
-            uint16_t       count = Traits::Screen::BYTE_COUNT;
-            do {
-                sendData(pgm_read_byte(bytes++));
-            } while(--count != 0);
+        if(_frame.buffer != nullptr) {
+            renderData(0, image, Traits::Screen::BYTE_COUNT, pgm);
         }
         else {
-            const uint8_t* bytes = image;
-            uint16_t       count = Traits::Screen::BYTE_COUNT;
-            do {
-                sendData(*bytes++);
-            } while(--count != 0);
+            sendAddress(0, 0);
+            sendDataBurst(image, Traits::Screen::BYTE_COUNT, pgm);
         }
     }
 }
 
-void PCD8544::setStdInstructionSet()
+void PCD8544::putImage(const uint8_t row, const uint8_t col, const uint8_t width, const uint8_t bankCount, const uint8_t* data, const bool pgm)
 {
-    typedef Command::FunctionSet command_traits;
-    const uint8_t operand = command_traits::std_inst_set;
-    const uint8_t command = command_traits::command(operand);
+    if((row >= Traits::Screen::MAX_ROWS) || (col >= Traits::Screen::MAX_COLS)) {
+        return;
+    }
+    const uint8_t span  = ((width     < (Traits::Screen::MAX_COLS - col)) ? width     : (Traits::Screen::MAX_COLS - col));
+    const uint8_t banks = ((bankCount < (Traits::Screen::MAX_ROWS - row)) ? bankCount : (Traits::Screen::MAX_ROWS - row));
 
-    sendCommand(command);
+    if((span == 0) || (banks == 0)) {
+        return;
+    }
+    /* copy to frame buffer, the rows are clipped but keep the source stride */ {
+        if(prepareFrame() != false) {
+            uint8_t bank = 0;
+            do {
+                uint8_t*       frame = &getFrameBank(row + bank)[col];
+                const uint8_t* bytes = &data[bank * width];
+                if(pgm != false) {
+                    ::memcpy_P(frame, bytes, span);
+                }
+                else {
+                    ::memcpy(frame, bytes, span);
+                }
+                markDirty((row + bank), col, (col + span - 1));
+            } while(++bank < banks);
+            return;
+        }
+    }
+    /* a full-width source is contiguous in ram, one address and one burst */ {
+        if((width == Traits::Screen::MAX_COLS) && (col == 0)) {
+            sendAddress(row, 0);
+            sendDataBurst(data, (span * banks), pgm);
+            return;
+        }
+    }
+    /* otherwise address each bank and stream its slice */ {
+        uint8_t bank = 0;
+        do {
+            sendAddress((row + bank), col);
+            sendDataBurst(&data[bank * width], span, pgm);
+        } while(++bank < banks);
+    }
 }
 
-void PCD8544::setExtInstructionSet()
+const uint8_t* PCD8544::putPackedImage(const uint8_t* data, const bool pgm)
 {
-    typedef Command::FunctionSet command_traits;
-    const uint8_t operand = command_traits::ext_inst_set;
-    const uint8_t command = command_traits::command(operand);
-
-    sendCommand(command);
+    const bool     frame  = prepareFrame();
+    const uint8_t* bytes  = data;
+    uint16_t       offset = 0;
+
+    while(true) {
+        const uint8_t opcode = (pgm != false ? pgm_read_byte(bytes++) : *bytes++);
+        const uint8_t kind   = (opcode & Traits::Packed::OPCODE_MASK);
+        const uint8_t length = ((opcode & Traits::Packed::LENGTH_MASK) + 1);
+        uint16_t      count  = (Traits::Screen::BYTE_COUNT - offset);
+
+        if(kind == Traits::Packed::END) {
+            break;
+        }
+        /* runs going past the end of the screen are clipped */ {
+            if(count > length) {
+                count = length;
+            }
+        }
+        /* skips only move the offset, the next run re-addresses the controller */ {
+            if((kind == Traits::Packed::REPEAT) && (count != 0)) {
+                const uint8_t value = (pgm != false ? pgm_read_byte(bytes) : *bytes);
+                if(frame != false) {
+                    renderFill(offset, value, count);
+                }
+                else {
+                    sendAddress((offset / Traits::Screen::MAX_COLS), (offset % Traits::Screen::MAX_COLS));
+                    fillData(value, count);
+                }
+            }
+            if((kind == Traits::Packed::LITERAL) && (count != 0)) {
+                if(frame != false) {
+                    renderData(offset, bytes, count, pgm);
+                }
+                else {
+                    sendAddress((offset / Traits::Screen::MAX_COLS), (offset % Traits::Screen::MAX_COLS));
+                    sendDataBurst(bytes, count, pgm);
+                }
+            }
+        }
+        /* move to the next opcode */ {
+            if(kind == Traits::Packed::REPEAT) {
+                bytes += 1;
+            }
+            if(kind == Traits::Packed::LITERAL) {
+                bytes += length;
+            }
+            offset += count;
+        }
+    }
+    return bytes;
 }
 
-void PCD8544::setPowerDownMode()
+void PCD8544::setFrameBuffer(uint8_t* buffer)
 {
-    typedef Command::FunctionSet command_traits;
-    const uint8_t operand = command_traits::power_down;
-    const uint8_t command = command_traits::command(operand);
+    waitIdle();
 
-    sendCommand(command);
+    _frame.buffer = buffer;
+    _frame.top    = 0;
+
+    if(_frame.buffer != nullptr) {
+        invalidate();
+    }
+    else {
+        sendAddress(_cursor.curr_row, _cursor.curr_col);
+    }
 }
 
-void PCD8544::setBlankMode()
+uint8_t* PCD8544::getFrameBuffer() const
 {
-    typedef Command::DisplayControl command_traits;
-    const uint8_t operand = command_traits::blank_mode;
-    const uint8_t command = command_traits::command(operand);
-
-    sendCommand(command);
+    return _frame.buffer;
 }
 
-void PCD8544::setBlackMode()
+void PCD8544::setShadowBuffer(uint8_t* buffer)
 {
-    typedef Command::DisplayControl command_traits;
-    const uint8_t operand = command_traits::black_mode;
-    const uint8_t command = command_traits::command(operand);
+    waitIdle();
 
-    sendCommand(command);
+    _frame.shadow = buffer;
+
+    invalidate();
 }
 
-void PCD8544::setNormalMode()
+uint8_t* PCD8544::getShadowBuffer() const
 {
-    typedef Command::DisplayControl command_traits;
-    const uint8_t operand = command_traits::normal_mode;
-    const uint8_t command = command_traits::command(operand);
-
-    sendCommand(command);
+    return _frame.shadow;
 }
 
-void PCD8544::setInverseMode()
+void PCD8544::invalidate()
 {
-    typedef Command::DisplayControl command_traits;
-    const uint8_t operand = command_traits::inverse_mode;
-    const uint8_t command = command_traits::command(operand);
-
-    sendCommand(command);
+    /* the display ram content is unknown */ {
+        _frame.synced = false;
+    }
+    /* everything is dirty */ {
+        uint8_t row = 0;
+        do {
+            markDirty(row, 0, (Traits::Screen::MAX_COLS - 1));
+        } while(++row < Traits::Screen::MAX_ROWS);
+    }
 }
 
-void PCD8544::setRowAddressOfRam(const uint8_t value)
+void PCD8544::setCellBuffer(uint8_t* buffer)
 {
-    /* adjust cursor row */ {
-        _cursor.curr_row = (value % Traits::Screen::MAX_ROWS);
-        _cursor.wrap_row = false;
+    _cells.buffer = buffer;
+
+    /* every cell must be rendered */ {
+        for(uint8_t line = 0; line < Traits::Cells::ROWS; ++line) {
+            _cells.dirty[line]   = 0xffff;
+            _cells.reverse[line] = 0x0000;
+        }
     }
-    typedef Command::SetRowAddressOfRam command_traits;
-    const uint8_t operand = command_traits::operand(_cursor.curr_row);
-    const uint8_t command = command_traits::command(operand);
+    if(_cells.buffer == nullptr) {
+        sendAddress(_cursor.curr_row, _cursor.curr_col);
+    }
+}
 
-    sendCommand(command);
+uint8_t* PCD8544::getCellBuffer() const
+{
+    return _cells.buffer;
 }
 
-void PCD8544::setColAddressOfRam(const uint8_t value)
+void PCD8544::refresh()
 {
-    /* adjust cursor col */ {
-        _cursor.curr_col = (value % Traits::Screen::MAX_COLS);
-        _cursor.wrap_col = false;
-    }
-    typedef Command::SetColAddressOfRam command_traits;
-    const uint8_t operand = command_traits::operand(_cursor.curr_col);
-    const uint8_t command = command_traits::command(operand);
+    uint8_t bytes[Traits::Screen::MAX_COLS];
 
-    sendCommand(command);
+    if(_cells.buffer == nullptr) {
+        return;
+    }
+    for(uint8_t line = 0; line < Traits::Cells::ROWS; ++line) {
+        uint16_t dirty = (_cells.dirty[line] & ((1 << Traits::Cells::COLS) - 1));
+        uint8_t  cell  = 0;
+        /* consecutive dirty cells are sent in one burst */
+        while(dirty != 0) {
+            if((dirty & 1) == 0) {
+                dirty >>= 1;
+                ++cell;
+                continue;
+            }
+            const uint8_t begin  = cell;
+            uint8_t       length = 0;
+            do {
+                length += renderCell(line, cell, &bytes[length]);
+                dirty >>= 1;
+                ++cell;
+            } while((dirty & 1) != 0);
+            putBank(line, (begin * Traits::Cells::WIDTH), bytes, length);
+        }
+        _cells.dirty[line] = 0;
+    }
 }
 
-void PCD8544::setTempCtrl(const uint8_t value)
+void PCD8544::flush()
 {
-    typedef Command::TempCtrl command_traits;
-    const uint8_t operand = command_traits::operand(value);
-    const uint8_t command = command_traits::command(operand);
+    if(_frame.buffer == nullptr) {
+        return;
+    }
+    const bool diff = ((_frame.shadow != nullptr) && (_frame.synced != false));
+#if PCD8544_STATS
+    const uint32_t started = ::micros();
+#endif
 
-    sendCommand(command);
+    /* tall and narrow regions are cheaper in vertical addressing mode */ {
+        if(verticalCost() < horizontalCost()) {
+            flushVertical(diff);
+        }
+        else {
+            flushHorizontal(diff);
+        }
+    }
+    /* all clean */ {
+        clearDirty();
+        if(_frame.shadow != nullptr) {
+            _frame.synced = true;
+        }
+    }
+#if PCD8544_STATS
+    /* update stats */ {
+        ++_stats.flushes;
+        _stats.flush_us += (::micros() - started);
+    }
+#endif
 }
 
-void PCD8544::setBiasSyst(const uint8_t value)
+bool PCD8544::busy() const
 {
-    typedef Command::BiasSyst command_traits;
-    const uint8_t operand = command_traits::operand(value);
-    const uint8_t command = command_traits::command(operand);
-
-    sendCommand(command);
+    return _transport.busy();
 }
 
-void PCD8544::setVoltOper(const uint8_t value)
+void PCD8544::waitIdle()
 {
-    typedef Command::VoltOper command_traits;
-    const uint8_t operand = command_traits::operand(value);
-    const uint8_t command = command_traits::command(operand);
+    _transport.waitIdle();
+}
 
-    sendCommand(command);
+PCD8544_Stats PCD8544::getStats() const
+{
+#if PCD8544_STATS
+    return _stats;
+#else
+    return Stats { 0, 0, 0, 0, 0, 0 };
+#endif
 }
 
-void PCD8544::sendCommand(const uint8_t value)
+void PCD8544::resetStats()
 {
-    /* command mode */ {
-        ::digitalWrite(_wiring.modePin, 0x0);
-    }
-    /* chip enable */ {
-        ::digitalWrite(_wiring.cselPin, 0x0);
-    }
-    /* send command */ {
-        ::shiftOut(_wiring.dataPin, _wiring.sclkPin, MSBFIRST, value);
-    }
-    /* chip disable */ {
-        ::digitalWrite(_wiring.cselPin, 0x1);
-    }
+#if PCD8544_STATS
+    _stats = Stats { 0, 0, 0, 0, 0, 0 };
+#endif
 }
 
-void PCD8544::sendData(const uint8_t value)
+void PCD8544::drawPixel(const int16_t x, const int16_t y, const uint8_t color)
 {
-    /* data mode */ {
-        ::digitalWrite(_wiring.modePin, 0x1);
-    }
-    /* chip enable */ {
-        ::digitalWrite(_wiring.cselPin, 0x0);
-    }
-    /* send data */ {
-        ::shiftOut(_wiring.dataPin, _wiring.sclkPin, MSBFIRST, value);
-    }
-    /* chip disable */ {
-        ::digitalWrite(_wiring.cselPin, 0x1);
+    if(prepareFrame() == false) {
+        return;
     }
+    plotPixel(x, y, color);
 }
 
-size_t PCD8544::write(uint8_t character)
+void PCD8544::drawHLine(const int16_t x, const int16_t y, const int16_t w, const uint8_t color)
 {
-    const uint8_t curr_chr = (character & 0x80 ? 0x7f : character);
-    const uint8_t prev_chr = _cursor.prev_chr;
+    fillRect(x, y, w, 1, color);
+}
 
+void PCD8544::drawVLine(const int16_t x, const int16_t y, const int16_t h, const uint8_t color)
+{
+    fillRect(x, y, 1, h, color);
+}
+
+void PCD8544::drawLine(const int16_t x0, const int16_t y0, const int16_t x1, const int16_t y1, const uint8_t color)
+{
+    /* horizontal and vertical lines use the byte masks */ {
+        if(y0 == y1) {
+            drawHLine((x0 < x1 ? x0 : x1), y0, ((x0 < x1 ? (x1 - x0) : (x0 - x1)) + 1), color);
+            return;
+        }
+        if(x0 == x1) {
+            drawVLine(x0, (y0 < y1 ? y0 : y1), ((y0 < y1 ? (y1 - y0) : (y0 - y1)) + 1), color);
+            return;
+        }
+    }
+    if(prepareFrame() == false) {
+        return;
+    }
+    /* bresenham */ {
+        const int16_t dx = (x1 > x0 ? (x1 - x0) : (x0 - x1));
+        const int16_t dy = (y1 > y0 ? (y0 - y1) : (y1 - y0));
+        const int16_t sx = (x1 > x0 ? 1 : -1);
+        const int16_t sy = (y1 > y0 ? 1 : -1);
+        int16_t       x  = x0;
+        int16_t       y  = y0;
+        int16_t       e  = (dx + dy);
+        for(;;) {
+            plotPixel(x, y, color);
+            if((x == x1) && (y == y1)) {
+                break;
+            }
+            const int16_t e2 = (2 * e);
+            if(e2 >= dy) {
+                e += dy;
+                x += sx;
+            }
+            if(e2 <= dx) {
+                e += dx;
+                y += sy;
+            }
+        }
+    }
+}
+
+void PCD8544::drawRect(const int16_t x, const int16_t y, const int16_t w, const int16_t h, const uint8_t color)
+{
+    if((w <= 0) || (h <= 0)) {
+        return;
+    }
+    drawHLine(x, y, w, color);
+    if(h > 1) {
+        drawHLine(x, (y + h - 1), w, color);
+    }
+    if(h > 2) {
+        drawVLine(x, (y + 1), (h - 2), color);
+        if(w > 1) {
+            drawVLine((x + w - 1), (y + 1), (h - 2), color);
+        }
+    }
+}
+
+void PCD8544::fillRect(const int16_t x, const int16_t y, const int16_t w, const int16_t h, const uint8_t color)
+{
+    constexpr int16_t max_x = (Traits::Screen::MAX_COLS - 1);
+    constexpr int16_t max_y = ((Traits::Screen::MAX_ROWS * 8) - 1);
+
+    if(prepareFrame() == false) {
+        return;
+    }
+    /* clip */
+    const int16_t x0 = (x < 0 ? 0 : x);
+    const int16_t y0 = (y < 0 ? 0 : y);
+    const int16_t x1 = ((x + w - 1) > max_x ? max_x : (x + w - 1));
+    const int16_t y1 = ((y + h - 1) > max_y ? max_y : (y + h - 1));
+
+    if((w <= 0) || (h <= 0) || (x0 > x1) || (y0 > y1)) {
+        return;
+    }
+    /* one whole-byte mask per bank */ {
+        const uint8_t min_row = (y0 / 8);
+        const uint8_t max_row = (y1 / 8);
+        for(uint8_t row = min_row; row <= max_row; ++row) {
+            const uint8_t lo   = (row == min_row ? (y0 % 8) : 0);
+            const uint8_t hi   = (row == max_row ? (y1 % 8) : 7);
+            const uint8_t mask = ((0xff << lo) & (0xff >> (7 - hi)));
+            applyMask(row, x0, x1, mask, color);
+        }
+    }
+}
+
+void PCD8544::drawCircle(const int16_t x0, const int16_t y0, const int16_t r, const uint8_t color)
+{
+    if((r < 0) || (prepareFrame() == false)) {
+        return;
+    }
+    /* midpoint circle, eight octants */ {
+        int16_t x = r;
+        int16_t y = 0;
+        int16_t e = (1 - r);
+        while(x >= y) {
+            plotPixel((x0 + x), (y0 + y), color);
+            plotPixel((x0 - x), (y0 + y), color);
+            if(y != 0) {
+                plotPixel((x0 + x), (y0 - y), color);
+                plotPixel((x0 - x), (y0 - y), color);
+            }
+            if(x != y) {
+                plotPixel((x0 + y), (y0 + x), color);
+                plotPixel((x0 + y), (y0 - x), color);
+                if(y != 0) {
+                    plotPixel((x0 - y), (y0 + x), color);
+                    plotPixel((x0 - y), (y0 - x), color);
+                }
+            }
+            ++y;
+            if(e < 0) {
+                e += ((2 * y) + 1);
+            }
+            else {
+                --x;
+                e += ((2 * (y - x)) + 1);
+            }
+        }
+    }
+}
+
+void PCD8544::drawBitmap(const int16_t x, const int16_t y, const int16_t w, const int16_t h, const uint8_t* data, const bool pgm, const uint8_t mode, const uint8_t* mask)
+{
+    constexpr int16_t max_x = (Traits::Screen::MAX_COLS - 1);
+
+    if((w <= 0) || (h <= 0) || (prepareFrame() == false)) {
+        return;
+    }
+    /* clip columns */
+    const int16_t min_col = (x < 0 ? 0 : x);
+    const int16_t max_col = ((x + w - 1) > max_x ? max_x : (x + w - 1));
+
+    if(min_col > max_col) {
+        return;
+    }
+    /* each source bank is shifted and merged into the two banks it spans */
+    const int16_t banks = ((h + 7) / 8);
+    const int16_t top   = (y >= 0 ? (y / 8) : -((7 - y) / 8));
+    const uint8_t shift = (y - (top * 8));
+
+    for(int16_t bank = 0; bank < banks; ++bank) {
+        const int16_t row_lo  = (top + bank);
+        const int16_t row_hi  = (row_lo + 1);
+        const bool    has_lo  = ((row_lo >= 0) && (row_lo < Traits::Screen::MAX_ROWS));
+        const bool    has_hi  = ((shift != 0) && (row_hi >= 0) && (row_hi < Traits::Screen::MAX_ROWS));
+        const uint8_t rows    = (((bank == (banks - 1)) && ((h % 8) != 0)) ? (0xff >> (8 - (h % 8))) : 0xff);
+        const uint16_t offset = ((bank * w) - x);
+
+        if((has_lo == false) && (has_hi == false)) {
+            continue;
+        }
+        for(int16_t col = min_col; col <= max_col; ++col) {
+            const uint16_t index = (offset + col);
+            const uint8_t  value = (pgm != false ? pgm_read_byte(&data[index]) : data[index]);
+            uint8_t        alpha = rows;
+            if(mask != nullptr) {
+                alpha &= (pgm != false ? pgm_read_byte(&mask[index]) : mask[index]);
+            }
+            const uint16_t value16 = (static_cast<uint16_t>(value) << shift);
+            const uint16_t alpha16 = (static_cast<uint16_t>(alpha) << shift);
+            if(has_lo != false) {
+                blendByte(getFrameBank(row_lo)[col], (value16 & 0xff), (alpha16 & 0xff), mode);
+            }
+            if(has_hi != false) {
+                blendByte(getFrameBank(row_hi)[col], (value16 >> 8), (alpha16 >> 8), mode);
+            }
+        }
+        if(has_lo != false) {
+            markDirty(row_lo, min_col, max_col);
+        }
+        if(has_hi != false) {
+            markDirty(row_hi, min_col, max_col);
+        }
+    }
+}
+
+void PCD8544::setStdInstructionSet()
+{
+    syncState();
+
+    typedef Command::FunctionSet command_traits;
+    const uint8_t operand = (command_traits::std_inst_set | getAddressingMode());
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.function_set == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setExtInstructionSet()
+{
+    syncState();
+
+    typedef Command::FunctionSet command_traits;
+    const uint8_t operand = (command_traits::ext_inst_set | getAddressingMode());
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.function_set == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setPowerDownMode()
+{
+    syncState();
+
+    typedef Command::FunctionSet command_traits;
+    const uint8_t operand = (command_traits::power_down | getAddressingMode());
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.function_set == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setHorizontalAddressing()
+{
+    syncState();
+
+    typedef Command::FunctionSet command_traits;
+    const uint8_t operand = (command_traits::std_inst_set | command_traits::h_addressing);
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.function_set == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setVerticalAddressing()
+{
+    syncState();
+
+    typedef Command::FunctionSet command_traits;
+    const uint8_t operand = (command_traits::std_inst_set | command_traits::v_addressing);
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.function_set == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setBlankMode()
+{
+    syncState();
+
+    typedef Command::DisplayControl command_traits;
+    const uint8_t operand = command_traits::blank_mode;
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.display_control == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setBlackMode()
+{
+    syncState();
+
+    typedef Command::DisplayControl command_traits;
+    const uint8_t operand = command_traits::black_mode;
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.display_control == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setNormalMode()
+{
+    syncState();
+
+    typedef Command::DisplayControl command_traits;
+    const uint8_t operand = command_traits::normal_mode;
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.display_control == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setInverseMode()
+{
+    syncState();
+
+    typedef Command::DisplayControl command_traits;
+    const uint8_t operand = command_traits::inverse_mode;
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.display_control == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setRowAddressOfRam(const uint8_t value)
+{
+    syncState();
+
+    /* adjust cursor row */ {
+        _cursor.curr_row = (value % Traits::Screen::MAX_ROWS);
+        _cursor.wrap_row = false;
+    }
+    typedef Command::SetRowAddressOfRam command_traits;
+    const uint8_t operand = command_traits::operand(_cursor.curr_row);
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.ram_row == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setColAddressOfRam(const uint8_t value)
+{
+    syncState();
+
+    /* adjust cursor col */ {
+        _cursor.curr_col = (value % Traits::Screen::MAX_COLS);
+        _cursor.wrap_col = false;
+    }
+    typedef Command::SetColAddressOfRam command_traits;
+    const uint8_t operand = command_traits::operand(_cursor.curr_col);
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.ram_col == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setTempCtrl(const uint8_t value)
+{
+    syncState();
+
+    typedef Command::TempCtrl command_traits;
+    const uint8_t operand = command_traits::operand(value);
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.temp_ctrl == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setBiasSyst(const uint8_t value)
+{
+    syncState();
+
+    typedef Command::BiasSyst command_traits;
+    const uint8_t operand = command_traits::operand(value);
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.bias_syst == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::setVoltOper(const uint8_t value)
+{
+    syncState();
+
+    typedef Command::VoltOper command_traits;
+    const uint8_t operand = command_traits::operand(value);
+    const uint8_t command = command_traits::command(operand);
+
+    if(_state.volt_oper == (operand & command_traits::operand_mask)) {
+        return;
+    }
+    sendCommand(command);
+}
+
+void PCD8544::sendCommand(const uint8_t value)
+{
+#if PCD8544_STATS
+    const uint32_t started = ::micros();
+    /* address commands are only decoded in the basic instruction set */ {
+        if(((_state.function_set & Command::FunctionSet::ext_inst_set) == 0)
+        && (Command::SetColAddressOfRam::match(value) || Command::SetRowAddressOfRam::match(value))) {
+            ++_stats.address_commands;
+        }
+    }
+#endif
+    _transport.sendCommand(value);
+    updateState(value);
+#if PCD8544_STATS
+    /* update stats */ {
+        ++_stats.commands;
+        _stats.bus_us += (::micros() - started);
+    }
+#endif
+}
+
+void PCD8544::sendData(const uint8_t value)
+{
+    sendDataBurst(&value, 1, false);
+}
+
+void PCD8544::sendDataBurst(const uint8_t* data, const uint16_t count, const bool pgm)
+{
+#if PCD8544_STATS
+    const uint32_t started = ::micros();
+#endif
+    _transport.sendData(data, count, pgm);
+    advanceAddress(count);
+#if PCD8544_STATS
+    /* update stats */ {
+        _stats.data_bytes += count;
+        _stats.bus_us     += (::micros() - started);
+    }
+#endif
+}
+
+void PCD8544::fillData(const uint8_t value, const uint16_t count)
+{
+#if PCD8544_STATS
+    const uint32_t started = ::micros();
+#endif
+    _transport.fillData(value, count);
+    advanceAddress(count);
+#if PCD8544_STATS
+    /* update stats */ {
+        _stats.data_bytes += count;
+        _stats.bus_us     += (::micros() - started);
+    }
+#endif
+}
+
+size_t PCD8544::write(uint8_t character)
+{
+    const uint8_t curr_chr = character;
+    const uint8_t prev_chr = _cursor.prev_chr;
+    const uint8_t height   = getLineHeight();
+
+    /* escape sequences are parsed apart from the text */ {
+        if(_escape.state != Traits::Escape::STATE_NONE) {
+            processEscape(curr_chr);
+            return 1;
+        }
+    }
     /* adjust cursor */ {
         _cursor.prev_chr = curr_chr;
     }
@@ -633,40 +1360,1131 @@ size_t PCD8544::write(uint8_t character)
         }
         if(curr_chr == '\n') {
             if(_cursor.wrap_col == false) {
-                setRowAddressOfRam(_cursor.curr_row + (Traits::Screen::MAX_ROWS + 1));
+                moveCursorRow(scrollLines((_cursor.curr_row + height), height));
             }
-            setColAddressOfRam(0);
+            moveCursorCol(0);
             return 1;
         }
         if(prev_chr == '\r') {
             if(_cursor.wrap_col != false) {
-                setRowAddressOfRam(_cursor.curr_row + (Traits::Screen::MAX_ROWS - 1));
+                moveCursorRow(_cursor.curr_row + (Traits::Screen::MAX_ROWS - height));
             }
-            setColAddressOfRam(0);
+            moveCursorCol(0);
+        }
+        if(curr_chr == Traits::Escape::ESC) {
+            _escape.state = Traits::Escape::STATE_ESC;
+            return 1;
         }
     }
-    /* adjust cursor */ {
-        _cursor.wrap_row = false;
-        _cursor.wrap_col = false;
-    }
-    /* send data to screen */ {
-        const uint8_t* bytes = &font6x8[curr_chr][0];
-        uint16_t       count = countof(font6x8[curr_chr]);
-        do {
-            sendData(pgm_read_byte(bytes++));
-            if(++_cursor.curr_col >= Traits::Screen::MAX_COLS) {
-                _cursor.curr_col = 0;
-                _cursor.wrap_col = true;
-                if(++_cursor.curr_row >= Traits::Screen::MAX_ROWS) {
-                    _cursor.curr_row = 0;
-                    _cursor.wrap_row = true;
-                }
-            }
-        } while(--count != 0);
+    /* send glyph to screen */ {
+        putGlyphs(&character, 1);
     }
     return 1;
 }
 
+size_t PCD8544::write(const uint8_t* buffer, size_t size)
+{
+    const uint8_t* chars = buffer;
+    size_t         chars_left = size;
+
+    while(chars_left != 0) {
+        uint16_t offset = 0;
+        uint8_t  count  = 1;
+        uint16_t width  = (getGlyph(*_text.font, *chars, offset) * _text.scale);
+
+        /* control characters go through the state machine */ {
+            if((*chars == '\r') || (*chars == '\n') || (*chars == Traits::Escape::ESC)
+            || (_cursor.prev_chr == '\r') || (_escape.state != Traits::Escape::STATE_NONE)) {
+                write(*chars++);
+                --chars_left;
+                continue;
+            }
+        }
+        /* lay out glyphs up to the end of the line or the next control character */ {
+            const uint8_t curr_col = ((_cursor.curr_col + width) > Traits::Screen::MAX_COLS ? 0 : _cursor.curr_col);
+            while(count < chars_left) {
+                const uint8_t next_chr = chars[count];
+                if((next_chr == '\r') || (next_chr == '\n') || (next_chr == Traits::Escape::ESC)) {
+                    break;
+                }
+                const uint16_t next_width = (getGlyph(*_text.font, next_chr, offset) * _text.scale);
+                if((curr_col + width + next_width) > Traits::Screen::MAX_COLS) {
+                    break;
+                }
+                width += next_width;
+                ++count;
+            }
+        }
+        /* send the run to screen */ {
+            putGlyphs(chars, count);
+            _cursor.prev_chr = chars[count - 1];
+            chars      += count;
+            chars_left -= count;
+        }
+    }
+    return size;
+}
+
+void PCD8544::setup()
+{
+    /* setup */ {
+        if(_wiring.resetPin != Traits::Setup::NO_PIN) {
+            ::pinMode(_wiring.resetPin, Traits::Setup::RESET_PINMODE);
+        }
+        if(_wiring.lightPin != Traits::Setup::NO_PIN) {
+            ::pinMode(_wiring.lightPin, Traits::Setup::LIGHT_PINMODE);
+        }
+    }
+    /* transport */ {
+        _transport.begin();
+    }
+}
+
+void PCD8544::resetState()
+{
+    /* reset cursor values */ {
+        _cursor.prev_chr = Traits::Initial::PREV_CHR;
+        _cursor.curr_row = Traits::Initial::CURR_ROW;
+        _cursor.curr_col = Traits::Initial::CURR_COL;
+        _cursor.wrap_row = Traits::Initial::WRAP_ROW;
+        _cursor.wrap_col = Traits::Initial::WRAP_COL;
+    }
+    /* forget the controller state */ {
+        _state.function_set    = Traits::Control::UNKNOWN;
+        _state.display_control = Traits::Control::UNKNOWN;
+        _state.temp_ctrl       = Traits::Control::UNKNOWN;
+        _state.bias_syst       = Traits::Control::UNKNOWN;
+        _state.volt_oper       = Traits::Control::UNKNOWN;
+        _state.ram_row         = Traits::Control::UNKNOWN;
+        _state.ram_col         = Traits::Control::UNKNOWN;
+    }
+    /* no startup in progress */ {
+        _startup.step = Traits::Startup::STEP_READY;
+    }
+}
+
+void PCD8544::syncState()
+{
+    /* a controller on a shared bus may have been driven by another display */ {
+        if(_transport.acquire() != false) {
+            return;
+        }
+    }
+    /* forget the controller state, then restore the function set */ {
+        const uint8_t function_set = (_state.function_set != Traits::Control::UNKNOWN ? _state.function_set
+                                                                                      : (Command::FunctionSet::std_inst_set | Command::FunctionSet::h_addressing));
+        _state.function_set    = Traits::Control::UNKNOWN;
+        _state.display_control = Traits::Control::UNKNOWN;
+        _state.temp_ctrl       = Traits::Control::UNKNOWN;
+        _state.bias_syst       = Traits::Control::UNKNOWN;
+        _state.volt_oper       = Traits::Control::UNKNOWN;
+        _state.ram_row         = Traits::Control::UNKNOWN;
+        _state.ram_col         = Traits::Control::UNKNOWN;
+        sendCommand(Command::FunctionSet::command(function_set));
+    }
+}
+
+void PCD8544::configure()
+{
+    setExtInstructionSet();
+    setTempCtrl(Command::TempCtrl::default_value);
+    setBiasSyst(Command::BiasSyst::default_value);
+    setVoltOper(Command::VoltOper::default_value);
+    setStdInstructionSet();
+    setNormalMode();
+}
+
+uint8_t PCD8544::getGlyph(const PCD8544_Font& font, const uint8_t character, uint16_t& offset) const
+{
+    uint8_t  index = 0;
+    uint16_t begin = 0;
+    uint8_t  width = font.width;
+
+    /* out-of-range characters */ {
+        if(character > font.last) {
+            index = (font.last - font.first);
+        }
+        else if(character >= font.first) {
+            index = (character - font.first);
+        }
+    }
+    /* fixed-width or proportional glyph */ {
+        if(font.offsets == nullptr) {
+            begin = (index * font.width);
+        }
+        else {
+            begin = pgm_read_word(&font.offsets[index + 0]);
+            width = pgm_read_word(&font.offsets[index + 1]) - begin;
+        }
+    }
+    /* characters below the range are blank */ {
+        if(character < font.first) {
+            offset = Traits::Font::NO_GLYPH;
+        }
+        else {
+            offset = (begin * font.height);
+        }
+    }
+    return width;
+}
+
+uint8_t PCD8544::getGlyphWidth(const PCD8544_Font& font, const uint8_t scale, const uint8_t character) const
+{
+    uint16_t offset = 0;
+
+    /* a cell is as wide as a cell, whatever the font and the scale */
+    if(_cells.buffer != nullptr) {
+        return Traits::Cells::WIDTH;
+    }
+    return (getGlyph(font, character, offset) * scale);
+}
+
+uint8_t PCD8544::getLineHeight() const
+{
+    /* a cell is one bank high, whatever the font and the scale */
+    if(_cells.buffer != nullptr) {
+        return 1;
+    }
+    return (_text.font->height * _text.scale);
+}
+
+uint8_t PCD8544::expandGlyph(const uint8_t value, const uint8_t part) const
+{
+    /* each source pixel becomes `scale` output pixels, one nibble at a time */
+    if(_text.scale == 2) {
+        return pgm_read_byte(&expand2x[(value >> (part * 4)) & 0x0f]);
+    }
+    if(_text.scale == 3) {
+        const uint32_t bits = (static_cast<uint32_t>(pgm_read_word(&expand3x[(value >> 0) & 0x0f])) <<  0)
+                            | (static_cast<uint32_t>(pgm_read_word(&expand3x[(value >> 4) & 0x0f])) << 12);
+        return static_cast<uint8_t>(bits >> (part * 8));
+    }
+    return value;
+}
+
+void PCD8544::putGlyphs(const uint8_t* chars, const uint8_t count)
+{
+    const PCD8544_Font& font   = *_text.font;
+    const uint8_t       scale  = _text.scale;
+    const uint8_t       height = (font.height * scale);
+    uint16_t            width  = 0;
+
+    /* in cell mode the text only updates the cells */ {
+        if(_cells.buffer != nullptr) {
+            putCells(chars, count);
+            return;
+        }
+    }
+    /* measure the run */ {
+        for(uint8_t index = 0; index < count; ++index) {
+            uint16_t offset = 0;
+            width += (getGlyph(font, chars[index], offset) * scale);
+        }
+    }
+    /* a glyph that does not fit starts on the next line */ {
+        if((_cursor.curr_col + width) > Traits::Screen::MAX_COLS) {
+            _cursor.curr_row = (scrollLines((_cursor.curr_row + height), height) % Traits::Screen::MAX_ROWS);
+            _cursor.curr_col = 0;
+        }
+        else {
+            _cursor.curr_row = scrollLines(_cursor.curr_row, height);
+        }
+        _cursor.wrap_row = false;
+        _cursor.wrap_col = false;
+    }
+    /* send the run */ {
+        putGlyphsAt(_cursor.curr_row, _cursor.curr_col, chars, count, font, scale, 0);
+    }
+    /* advance the cursor, wrapping like the controller does */ {
+        uint16_t curr_col = (_cursor.curr_col + width);
+        uint16_t curr_row = _cursor.curr_row;
+        if(curr_col >= Traits::Screen::MAX_COLS) {
+            curr_col = 0;
+            curr_row = scrollLines((curr_row + height), height);
+            _cursor.wrap_col = true;
+            if(curr_row >= Traits::Screen::MAX_ROWS) {
+                curr_row %= Traits::Screen::MAX_ROWS;
+                _cursor.wrap_row = true;
+            }
+        }
+        _cursor.curr_row = curr_row;
+        _cursor.curr_col = curr_col;
+    }
+}
+
+void PCD8544::putGlyphsAt(const uint8_t row, const uint8_t col, const uint8_t* chars, const uint8_t count, const PCD8544_Font& font, const uint8_t scale, const uint8_t padding)
+{
+    const uint8_t height = (font.height * scale);
+    const uint8_t blank  = (_text.reverse != false ? 0xff : 0x00);
+
+    /* in cell mode the glyphs only update the cells */ {
+        if(_cells.buffer != nullptr) {
+            for(uint8_t index = 0; index < count; ++index) {
+                const uint8_t cell = ((col / Traits::Cells::WIDTH) + index);
+                if(cell >= Traits::Cells::COLS) {
+                    break;
+                }
+                setCell((row % Traits::Cells::ROWS), cell, chars[index]);
+            }
+            return;
+        }
+    }
+    /* lay out and send the run, bank after bank, clipped to the line */ {
+        for(uint8_t bank = 0; bank < height; ++bank) {
+            const uint8_t src_bank = (bank / scale);
+            const uint8_t src_part = (bank % scale);
+            const uint8_t room     = (col < Traits::Screen::MAX_COLS ? (Traits::Screen::MAX_COLS - col) : 0);
+            uint8_t       bytes[Traits::Screen::MAX_COLS];
+            uint8_t       length = 0;
+            for(uint8_t index = 0; index < count; ++index) {
+                uint16_t      offset = 0;
+                const uint8_t span   = getGlyph(font, chars[index], offset);
+                if((length + (span * scale)) > room) {
+                    break;
+                }
+                if(offset == Traits::Font::NO_GLYPH) {
+                    ::memset(&bytes[length], 0x00, (span * scale));
+                    length += (span * scale);
+                }
+                else if(scale == 1) {
+                    ::memcpy_P(&bytes[length], &font.glyphs[offset + (src_bank * span)], span);
+                    length += span;
+                }
+                else {
+                    const uint8_t* glyph = &font.glyphs[offset + (src_bank * span)];
+                    for(uint8_t column = 0; column < span; ++column) {
+                        const uint8_t value = expandGlyph(pgm_read_byte(&glyph[column]), src_part);
+                        for(uint8_t repeat = 0; repeat < scale; ++repeat) {
+                            bytes[length++] = value;
+                        }
+                    }
+                }
+            }
+            if(blank != 0x00) {
+                for(uint8_t index = 0; index < length; ++index) {
+                    bytes[index] ^= 0xff;
+                }
+            }
+            /* the padding extends the same burst */ {
+                const uint8_t extra = ((length + padding) > room ? (room - length) : padding);
+                ::memset(&bytes[length], blank, extra);
+                length += extra;
+            }
+            putBank(((row + bank) % Traits::Screen::MAX_ROWS), col, bytes, length);
+        }
+    }
+}
+
+void PCD8544::putBank(const uint8_t row, const uint8_t col, const uint8_t* bytes, const uint8_t count)
+{
+    if(count == 0) {
+        return;
+    }
+    if(_frame.buffer != nullptr) {
+        /* do not race an in-flight transfer */ {
+            waitIdle();
+        }
+        /* copy to frame buffer */ {
+            ::memcpy(&getFrameBank(row)[col], bytes, count);
+            markDirty(row, col, (col + count - 1));
+        }
+    }
+    else {
+        sendAddress(row, col);
+        sendDataBurst(bytes, count, false);
+    }
+}
+
+void PCD8544::putCells(const uint8_t* chars, const uint8_t count)
+{
+    for(uint8_t index = 0; index < count; ++index) {
+        /* a cell that does not fit starts on the next line */ {
+            if((_cursor.curr_col + Traits::Cells::WIDTH) > Traits::Screen::MAX_COLS) {
+                _cursor.curr_row = ((_cursor.curr_row + 1) % Traits::Screen::MAX_ROWS);
+                _cursor.curr_col = 0;
+            }
+            _cursor.wrap_row = false;
+            _cursor.wrap_col = false;
+        }
+        setCell(_cursor.curr_row, (_cursor.curr_col / Traits::Cells::WIDTH), chars[index]);
+        /* advance the cursor, wrapping like the controller does */ {
+            _cursor.curr_col += Traits::Cells::WIDTH;
+            if(_cursor.curr_col >= Traits::Screen::MAX_COLS) {
+                _cursor.curr_col = 0;
+                _cursor.wrap_col = true;
+                if(++_cursor.curr_row >= Traits::Screen::MAX_ROWS) {
+                    _cursor.curr_row = 0;
+                    _cursor.wrap_row = true;
+                }
+            }
+        }
+    }
+}
+
+void PCD8544::setCell(const uint8_t line, const uint8_t cell, const uint8_t character)
+{
+    uint8_t&       slot    = _cells.buffer[(line * Traits::Cells::COLS) + cell];
+    const uint16_t mask    = (1 << cell);
+    const uint16_t reverse = (_text.reverse != false ? mask : 0);
+
+    if((slot != character) || ((_cells.reverse[line] & mask) != reverse)) {
+        slot = character;
+        _cells.reverse[line] = ((_cells.reverse[line] & ~mask) | reverse);
+        _cells.dirty[line]  |= mask;
+    }
+}
+
+uint8_t PCD8544::renderCell(const uint8_t line, const uint8_t cell, uint8_t* bytes) const
+{
+    const PCD8544_Font& font   = *_text.font;
+    uint16_t            offset = 0;
+    uint8_t             span   = getGlyph(font, _cells.buffer[(line * Traits::Cells::COLS) + cell], offset);
+
+    /* the first bank of the glyph, clipped or padded to the cell */ {
+        if(span > Traits::Cells::WIDTH) {
+            span = Traits::Cells::WIDTH;
+        }
+        if(offset == Traits::Font::NO_GLYPH) {
+            span = 0;
+        }
+        ::memcpy_P(bytes, &font.glyphs[offset], span);
+        ::memset(&bytes[span], 0x00, (Traits::Cells::WIDTH - span));
+    }
+    if((_cells.reverse[line] & (1 << cell)) != 0) {
+        for(uint8_t index = 0; index < Traits::Cells::WIDTH; ++index) {
+            bytes[index] ^= 0xff;
+        }
+    }
+    return Traits::Cells::WIDTH;
+}
+
+void PCD8544::fillBank(const uint8_t row, const uint8_t col, const uint8_t value, const uint8_t count)
+{
+    if(count == 0) {
+        return;
+    }
+    if(prepareFrame() != false) {
+        ::memset(&getFrameBank(row)[col], value, count);
+        markDirty(row, col, (col + count - 1));
+    }
+    else {
+        sendAddress(row, col);
+        fillData(value, count);
+    }
+}
+
+void PCD8544::processEscape(const uint8_t character)
+{
+    /* ESC must be followed by '[' to start a control sequence */ {
+        if(_escape.state == Traits::Escape::STATE_ESC) {
+            _escape.state = (character == '[' ? Traits::Escape::STATE_CSI : Traits::Escape::STATE_NONE);
+            _escape.count = 0;
+            ::memset(_escape.params, 0, sizeof(_escape.params));
+            return;
+        }
+    }
+    /* collect the numeric parameters, the extra ones are ignored */ {
+        if((character >= '0') && (character <= '9')) {
+            if(_escape.count == 0) {
+                _escape.count = 1;
+            }
+            if(_escape.count <= Traits::Escape::MAX_PARAMS) {
+                uint8_t&       param = _escape.params[_escape.count - 1];
+                const uint16_t value = ((param * 10) + (character - '0'));
+                param = (value < 0xff ? value : 0xff);
+            }
+            return;
+        }
+        if(character == ';') {
+            if(_escape.count == 0) {
+                _escape.count = 1;
+            }
+            if(_escape.count <= Traits::Escape::MAX_PARAMS) {
+                ++_escape.count;
+            }
+            return;
+        }
+    }
+    /* any other character ends the sequence */ {
+        _escape.state = Traits::Escape::STATE_NONE;
+    }
+    switch(character) {
+        case 'H':
+        case 'f':
+            moveToCell(_escape.params[0], _escape.params[1]);
+            break;
+        case 'J':
+            if(_escape.params[0] == 2) {
+                eraseDisplay();
+            }
+            break;
+        case 'K':
+            if(_escape.params[0] == 0) {
+                eraseLine();
+            }
+            break;
+        case 'm':
+            for(uint8_t index = 0; (index == 0) || (index < _escape.count); ++index) {
+                const uint8_t param = (index < Traits::Escape::MAX_PARAMS ? _escape.params[index] : 0);
+                if((param == 0) || (param == 27)) {
+                    _text.reverse = false;
+                }
+                else if(param == 7) {
+                    _text.reverse = true;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void PCD8544::moveToCell(const uint8_t line, const uint8_t cell)
+{
+    uint16_t      offset = 0;
+    const uint8_t space  = getGlyph(*_text.font, ' ', offset);
+    const uint8_t height = getLineHeight();
+    const uint8_t width  = (_cells.buffer != nullptr ? Traits::Cells::WIDTH : ((space != 0 ? space : 1) * _text.scale));
+    uint16_t      row    = (line > 1 ? ((line - 1) * height) : 0);
+    uint16_t      col    = (cell > 1 ? ((cell - 1) * width) : 0);
+
+    /* positions beyond the screen are clamped to the last line and cell */ {
+        if((row + height) > Traits::Screen::MAX_ROWS) {
+            row = (height < Traits::Screen::MAX_ROWS ? (((Traits::Screen::MAX_ROWS / height) - 1) * height) : 0);
+        }
+        if((col + width) > Traits::Screen::MAX_COLS) {
+            col = (width < Traits::Screen::MAX_COLS ? (((Traits::Screen::MAX_COLS / width) - 1) * width) : 0);
+        }
+    }
+    setCursor(row, col);
+}
+
+void PCD8544::eraseDisplay()
+{
+    const uint8_t value = (_text.reverse != false ? 0xff : 0x00);
+
+    /* in cell mode only the cells are erased */ {
+        if(_cells.buffer != nullptr) {
+            for(uint8_t line = 0; line < Traits::Cells::ROWS; ++line) {
+                for(uint8_t cell = 0; cell < Traits::Cells::COLS; ++cell) {
+                    setCell(line, cell, Traits::Cells::BLANK);
+                }
+            }
+            return;
+        }
+    }
+    /* the whole ram in one burst, the cursor does not move */ {
+        if(prepareFrame() != false) {
+            renderFill(0, value, Traits::Screen::BYTE_COUNT);
+        }
+        else {
+            sendAddress(0, 0);
+            fillData(value, Traits::Screen::BYTE_COUNT);
+        }
+    }
+}
+
+void PCD8544::eraseLine()
+{
+    const uint8_t value  = (_text.reverse != false ? 0xff : 0x00);
+    const uint8_t height = (_text.font->height * _text.scale);
+
+    /* in cell mode only the cells are erased */ {
+        if(_cells.buffer != nullptr) {
+            for(uint8_t cell = (_cursor.curr_col / Traits::Cells::WIDTH); cell < Traits::Cells::COLS; ++cell) {
+                setCell(_cursor.curr_row, cell, Traits::Cells::BLANK);
+            }
+            return;
+        }
+    }
+    /* one burst per bank of the line, from the cursor to the right edge */ {
+        for(uint8_t bank = 0; bank < height; ++bank) {
+            fillBank(((_cursor.curr_row + bank) % Traits::Screen::MAX_ROWS), _cursor.curr_col, value, (Traits::Screen::MAX_COLS - _cursor.curr_col));
+        }
+    }
+}
+
+void PCD8544::moveCursorRow(const uint8_t value)
+{
+    if((_frame.buffer != nullptr) || (_cells.buffer != nullptr)) {
+        _cursor.curr_row = (value % Traits::Screen::MAX_ROWS);
+        _cursor.wrap_row = false;
+    }
+    else {
+        setRowAddressOfRam(value);
+    }
+}
+
+void PCD8544::moveCursorCol(const uint8_t value)
+{
+    if((_frame.buffer != nullptr) || (_cells.buffer != nullptr)) {
+        _cursor.curr_col = (value % Traits::Screen::MAX_COLS);
+        _cursor.wrap_col = false;
+    }
+    else {
+        setColAddressOfRam(value);
+    }
+}
+
+void PCD8544::sendAddress(const uint8_t row, const uint8_t col)
+{
+    syncState();
+
+    /* row address */ {
+        typedef Command::SetRowAddressOfRam command_traits;
+        const uint8_t operand = command_traits::operand(row);
+        const uint8_t command = command_traits::command(operand);
+
+        if(_state.ram_row != operand) {
+            sendCommand(command);
+        }
+    }
+    /* col address */ {
+        typedef Command::SetColAddressOfRam command_traits;
+        const uint8_t operand = command_traits::operand(col);
+        const uint8_t command = command_traits::command(operand);
+
+        if(_state.ram_col != operand) {
+            sendCommand(command);
+        }
+    }
+}
+
+uint8_t PCD8544::getAddressingMode() const
+{
+    if(_state.function_set == Traits::Control::UNKNOWN) {
+        return Command::FunctionSet::h_addressing;
+    }
+    return (_state.function_set & Command::FunctionSet::v_addressing);
+}
+
+void PCD8544::updateState(const uint8_t value)
+{
+    /* function set is decoded in both instruction sets */ {
+        if(Command::FunctionSet::match(value)) {
+            _state.function_set = (value & Command::FunctionSet::operand_mask);
+            return;
+        }
+    }
+    /* the other commands depend on the instruction set */ {
+        if(_state.function_set == Traits::Control::UNKNOWN) {
+            return;
+        }
+    }
+    if((_state.function_set & Command::FunctionSet::ext_inst_set) == 0) {
+        if(Command::SetColAddressOfRam::match(value)) {
+            _state.ram_col = (value & Command::SetColAddressOfRam::operand_mask);
+        }
+        else if(Command::SetRowAddressOfRam::match(value)) {
+            _state.ram_row = (value & Command::SetRowAddressOfRam::operand_mask);
+        }
+        else if(Command::DisplayControl::match(value)) {
+            _state.display_control = (value & Command::DisplayControl::operand_mask);
+        }
+    }
+    else {
+        if(Command::VoltOper::match(value)) {
+            _state.volt_oper = (value & Command::VoltOper::operand_mask);
+        }
+        else if(Command::BiasSyst::match(value)) {
+            _state.bias_syst = (value & Command::BiasSyst::operand_mask);
+        }
+        else if(Command::TempCtrl::match(value)) {
+            _state.temp_ctrl = (value & Command::TempCtrl::operand_mask);
+        }
+    }
+}
+
+void PCD8544::advanceAddress(const uint16_t count)
+{
+    if((_state.ram_row == Traits::Control::UNKNOWN)
+    || (_state.ram_col == Traits::Control::UNKNOWN)
+    || (_state.function_set == Traits::Control::UNKNOWN)) {
+        _state.ram_row = Traits::Control::UNKNOWN;
+        _state.ram_col = Traits::Control::UNKNOWN;
+        return;
+    }
+    /* the controller auto-increments its address, wrapping around the ram */ {
+        if((_state.function_set & Command::FunctionSet::v_addressing) != 0) {
+            const uint16_t index = (((_state.ram_col * Traits::Screen::MAX_ROWS) + _state.ram_row + count) % Traits::Screen::BYTE_COUNT);
+            _state.ram_row = (index % Traits::Screen::MAX_ROWS);
+            _state.ram_col = (index / Traits::Screen::MAX_ROWS);
+        }
+        else {
+            const uint16_t index = (((_state.ram_row * Traits::Screen::MAX_COLS) + _state.ram_col + count) % Traits::Screen::BYTE_COUNT);
+            _state.ram_row = (index / Traits::Screen::MAX_COLS);
+            _state.ram_col = (index % Traits::Screen::MAX_COLS);
+        }
+    }
+}
+
+void PCD8544::markDirty(const uint8_t row, const uint8_t min_col, const uint8_t max_col)
+{
+    if(_frame.dirty_min[row] > min_col) {
+        _frame.dirty_min[row] = min_col;
+    }
+    if(_frame.dirty_max[row] < max_col) {
+        _frame.dirty_max[row] = max_col;
+    }
+}
+
+void PCD8544::clearDirty()
+{
+    uint8_t row = 0;
+    do {
+        _frame.dirty_min[row] = Traits::Screen::MAX_COLS;
+        _frame.dirty_max[row] = 0;
+    } while(++row < Traits::Screen::MAX_ROWS);
+}
+
+bool PCD8544::getDirtyBounds(uint8_t& min_row, uint8_t& max_row, uint8_t& min_col, uint8_t& max_col) const
+{
+    bool dirty = false;
+
+    min_row = Traits::Screen::MAX_ROWS;
+    max_row = 0;
+    min_col = Traits::Screen::MAX_COLS;
+    max_col = 0;
+    uint8_t row = 0;
+    do {
+        if(_frame.dirty_min[row] > _frame.dirty_max[row]) {
+            continue;
+        }
+        if(min_row > row) {
+            min_row = row;
+        }
+        if(max_row < row) {
+            max_row = row;
+        }
+        if(min_col > _frame.dirty_min[row]) {
+            min_col = _frame.dirty_min[row];
+        }
+        if(max_col < _frame.dirty_max[row]) {
+            max_col = _frame.dirty_max[row];
+        }
+        dirty = true;
+    } while(++row < Traits::Screen::MAX_ROWS);
+
+    return dirty;
+}
+
+uint16_t PCD8544::addressCost(const uint16_t from, const uint16_t to) const
+{
+    uint16_t cost = Traits::Flush::FRAMING_COST;
+
+    if(from == Traits::Flush::NO_ADDRESS) {
+        cost += Traits::Flush::ROW_ADDRESS_COST;
+        cost += Traits::Flush::COL_ADDRESS_COST;
+    }
+    else {
+        const uint16_t prev = (from % Traits::Screen::BYTE_COUNT);
+        if((prev / Traits::Screen::MAX_COLS) != (to / Traits::Screen::MAX_COLS)) {
+            cost += Traits::Flush::ROW_ADDRESS_COST;
+        }
+        if((prev % Traits::Screen::MAX_COLS) != (to % Traits::Screen::MAX_COLS)) {
+            cost += Traits::Flush::COL_ADDRESS_COST;
+        }
+    }
+    return cost;
+}
+
+uint16_t PCD8544::horizontalCost() const
+{
+    uint16_t cost = 0;
+    uint16_t prev = Traits::Flush::NO_ADDRESS;
+
+    uint8_t row = 0;
+    do {
+        const uint8_t min_col = _frame.dirty_min[row];
+        const uint8_t max_col = _frame.dirty_max[row];
+        if(min_col > max_col) {
+            continue;
+        }
+        const uint16_t begin = (row * Traits::Screen::MAX_COLS) + min_col;
+        const uint16_t end   = (row * Traits::Screen::MAX_COLS) + max_col + 1;
+        const uint16_t jump  = addressCost(prev, begin);
+        if((prev != Traits::Flush::NO_ADDRESS) && ((begin - prev) < jump)) {
+            cost += (begin - prev);
+        }
+        else {
+            cost += jump;
+        }
+        cost += (end - begin);
+        prev  = end;
+    } while(++row < Traits::Screen::MAX_ROWS);
+
+    return cost;
+}
+
+uint16_t PCD8544::verticalCost() const
+{
+    uint8_t min_row, max_row, min_col, max_col;
+
+    if(getDirtyBounds(min_row, max_row, min_col, max_col) == false) {
+        return Traits::Flush::NO_COST;
+    }
+    const uint16_t height = (max_row - min_row) + 1;
+    const uint16_t width  = (max_col - min_col) + 1;
+    const uint16_t jump   = ( Traits::Flush::FRAMING_COST
+                            + Traits::Flush::ROW_ADDRESS_COST
+                            + Traits::Flush::COL_ADDRESS_COST );
+    /* a full-height column auto-increments into the next column */ {
+        if(height == Traits::Screen::MAX_ROWS) {
+            return Traits::Flush::MODE_SWITCH_COST + jump + (width * height);
+        }
+    }
+    return Traits::Flush::MODE_SWITCH_COST + (width * (jump + height));
+}
+
+bool PCD8544::columnChanged(const uint8_t col, const uint8_t min_row, const uint8_t max_row, const bool diff) const
+{
+    uint8_t row = min_row;
+    do {
+        if(diff != false) {
+            if(getFrameBank(row)[col] != _frame.shadow[(row * Traits::Screen::MAX_COLS) + col]) {
+                return true;
+            }
+        }
+        else {
+            if((_frame.dirty_min[row] <= col) && (col <= _frame.dirty_max[row])) {
+                return true;
+            }
+        }
+    } while(++row <= max_row);
+
+    return false;
+}
+
+void PCD8544::flushHorizontal(const bool diff)
+{
+    Span span = { 0, 0 };
+
+    /* send dirty spans, or only the changed runs if the shadow is in sync */ {
+        uint8_t row = 0;
+        do {
+            const uint8_t min_col = _frame.dirty_min[row];
+            const uint8_t max_col = _frame.dirty_max[row];
+            if(min_col > max_col) {
+                continue;
+            }
+            const uint16_t offset = (row * Traits::Screen::MAX_COLS);
+            if(diff == false) {
+                queueSpan(span, (offset + min_col), (offset + max_col + 1));
+                continue;
+            }
+            const uint8_t* frame  = getFrameBank(row);
+            const uint8_t* shadow = &_frame.shadow[offset];
+            uint8_t        col    = min_col;
+            while(col <= max_col) {
+                if(frame[col] == shadow[col]) {
+                    ++col;
+                    continue;
+                }
+                const uint8_t begin = col;
+                do {
+                    ++col;
+                } while((col <= max_col) && (frame[col] != shadow[col]));
+                queueSpan(span, (offset + begin), (offset + col));
+            }
+        } while(++row < Traits::Screen::MAX_ROWS);
+        flushSpan(span);
+    }
+}
+
+void PCD8544::flushVertical(const bool diff)
+{
+    uint8_t min_row, max_row, min_col, max_col;
+
+    if(getDirtyBounds(min_row, max_row, min_col, max_col) == false) {
+        return;
+    }
+    const uint8_t height  = (max_row - min_row) + 1;
+    const uint8_t skip    = ( Traits::Flush::FRAMING_COST
+                            + Traits::Flush::COL_ADDRESS_COST );
+    uint8_t       begin   = 0;
+    uint8_t       end     = 0;
+
+    /* switch to vertical addressing */ {
+        setVerticalAddressing();
+    }
+    /* send changed columns, merging runs of full-height columns when cheaper */ {
+        uint8_t col = min_col;
+        do {
+            if(columnChanged(col, min_row, max_row, diff) == false) {
+                continue;
+            }
+            if(begin != end) {
+                if((height == Traits::Screen::MAX_ROWS) && (((col - end) * height) <= skip)) {
+                    end = (col + 1);
+                    continue;
+                }
+                flushColumns(begin, end, min_row, max_row);
+            }
+            begin = col;
+            end   = (col + 1);
+        } while(++col <= max_col);
+        flushColumns(begin, end, min_row, max_row);
+    }
+    /* back to horizontal addressing */ {
+        setHorizontalAddressing();
+    }
+}
+
+void PCD8544::flushColumns(const uint8_t begin, const uint8_t end, const uint8_t min_row, const uint8_t max_row)
+{
+    const bool full  = ((min_row == 0) && (max_row == (Traits::Screen::MAX_ROWS - 1)));
+    uint8_t    chunk[Traits::Screen::MAX_COLS];
+    uint8_t    count = 0;
+
+    if(begin == end) {
+        return;
+    }
+    uint8_t col = begin;
+    do {
+        /* move to column, full-height columns are chained by the controller */ {
+            if((full == false) || (count == 0)) {
+                sendAddress(min_row, col);
+            }
+        }
+        /* gather the column */ {
+            uint8_t row = min_row;
+            do {
+                const uint8_t value = getFrameBank(row)[col];
+                chunk[count++] = value;
+                if(_frame.shadow != nullptr) {
+                    _frame.shadow[(row * Traits::Screen::MAX_COLS) + col] = value;
+                }
+            } while(++row <= max_row);
+        }
+        /* send data when the chunk is full or the column cannot be chained */ {
+            if((full == false) || ((count + Traits::Screen::MAX_ROWS) > Traits::Screen::MAX_COLS) || ((col + 1) == end)) {
+                sendDataBurst(chunk, count, false);
+                count = 0;
+            }
+        }
+    } while(++col < end);
+}
+
+void PCD8544::queueSpan(Span& span, const uint16_t begin, const uint16_t end)
+{
+    /* merge with the pending span when re-sending the gap is cheaper than re-addressing */ {
+        if(span.begin != span.end) {
+            const uint16_t gap  = (begin - span.end);
+            const uint16_t cost = addressCost(span.end, begin);
+            if(gap <= cost) {
+                span.end = end;
+                return;
+            }
+            flushSpan(span);
+        }
+    }
+    /* start a new span */ {
+        span.begin = begin;
+        span.end   = end;
+    }
+}
+
+void PCD8544::flushSpan(Span& span)
+{
+    const uint16_t length = (span.end - span.begin);
+
+    if(length == 0) {
+        return;
+    }
+    /* move to span */ {
+        sendAddress((span.begin / Traits::Screen::MAX_COLS), (span.begin % Traits::Screen::MAX_COLS));
+    }
+    /* queue data in at most two parts, the frame buffer is a ring of banks */ {
+        const uint16_t origin = (_frame.top * Traits::Screen::MAX_COLS);
+        uint16_t       index  = ((origin + span.begin) % Traits::Screen::BYTE_COUNT);
+        uint16_t       count  = 0;
+        for(uint16_t done = 0; done < length; done += count) {
+            count = (length - done);
+            if(count > (Traits::Screen::BYTE_COUNT - index)) {
+                count = (Traits::Screen::BYTE_COUNT - index);
+            }
+            queueFrame(&_frame.buffer[index], count);
+            /* the display ram now holds this part */ {
+                if(_frame.shadow != nullptr) {
+                    ::memcpy(&_frame.shadow[span.begin + done], &_frame.buffer[index], count);
+                }
+            }
+            index = 0;
+        }
+    }
+    /* span is done */ {
+        span.begin = span.end;
+    }
+}
+
+void PCD8544::queueFrame(const uint8_t* data, const uint16_t count)
+{
+    /* the frame buffer is guarded until the transport is idle */ {
+#if PCD8544_STATS
+        const uint32_t started = ::micros();
+#endif
+        _transport.queueData(data, count);
+        advanceAddress(count);
+#if PCD8544_STATS
+        _stats.data_bytes += count;
+        _stats.bus_us     += (::micros() - started);
+#endif
+    }
+}
+
+uint8_t* PCD8544::getFrameBank(const uint8_t row) const
+{
+    uint8_t bank = (row + _frame.top);
+
+    if(bank >= Traits::Screen::MAX_ROWS) {
+        bank -= Traits::Screen::MAX_ROWS;
+    }
+    return &_frame.buffer[bank * Traits::Screen::MAX_COLS];
+}
+
+void PCD8544::scrollFrame(const uint8_t banks)
+{
+    const uint8_t count = (banks < Traits::Screen::MAX_ROWS ? banks : Traits::Screen::MAX_ROWS);
+
+    if((count == 0) || (prepareFrame() == false)) {
+        return;
+    }
+    /* rotate the ring, the banks scrolled out come back blank at the bottom */ {
+        _frame.top = ((_frame.top + count) % Traits::Screen::MAX_ROWS);
+        uint8_t row = (Traits::Screen::MAX_ROWS - count);
+        do {
+            ::memset(getFrameBank(row), 0x00, Traits::Screen::MAX_COLS);
+        } while(++row < Traits::Screen::MAX_ROWS);
+    }
+    /* every bank has moved on the glass */ {
+        uint8_t row = 0;
+        do {
+            markDirty(row, 0, (Traits::Screen::MAX_COLS - 1));
+        } while(++row < Traits::Screen::MAX_ROWS);
+    }
+}
+
+uint8_t PCD8544::scrollLines(const uint8_t row, const uint8_t height)
+{
+    /* in console mode the frame buffer scrolls up so that the next line fits */ {
+        if((_text.console != false) && (_frame.buffer != nullptr) && ((row + height) > Traits::Screen::MAX_ROWS)) {
+            scrollFrame((row + height) - Traits::Screen::MAX_ROWS);
+            return (height < Traits::Screen::MAX_ROWS ? (Traits::Screen::MAX_ROWS - height) : 0);
+        }
+    }
+    return row;
+}
+
+void PCD8544::renderData(const uint16_t offset, const uint8_t* data, const uint16_t count, const bool pgm)
+{
+    const uint8_t* bytes      = data;
+    uint16_t       bytes_left = count;
+    uint8_t        row        = (offset / Traits::Screen::MAX_COLS);
+    uint8_t        col        = (offset % Traits::Screen::MAX_COLS);
+
+    /* do not race an in-flight transfer */ {
+        waitIdle();
+    }
+    while(bytes_left != 0) {
+        uint8_t span = (Traits::Screen::MAX_COLS - col);
+        if(span > bytes_left) {
+            span = bytes_left;
+        }
+        /* copy to frame buffer */ {
+            uint8_t* frame = &getFrameBank(row)[col];
+            if(pgm != false) {
+                ::memcpy_P(frame, bytes, span);
+            }
+            else {
+                ::memcpy(frame, bytes, span);
+            }
+            markDirty(row, col, (col + span - 1));
+        }
+        /* wrap like the controller does */ {
+            bytes      += span;
+            bytes_left -= span;
+            col = 0;
+            if(++row >= Traits::Screen::MAX_ROWS) {
+                row = 0;
+            }
+        }
+    }
+}
+
+bool PCD8544::prepareFrame()
+{
+    if(_frame.buffer == nullptr) {
+        return false;
+    }
+    /* do not race an in-flight transfer */ {
+        waitIdle();
+    }
+    return true;
+}
+
+void PCD8544::plotPixel(const int16_t x, const int16_t y, const uint8_t color)
+{
+    if((x < 0) || (x >= Traits::Screen::MAX_COLS)
+    || (y < 0) || (y >= (Traits::Screen::MAX_ROWS * 8))) {
+        return;
+    }
+    applyMask((y / 8), x, x, (1 << (y % 8)), color);
+}
+
+void PCD8544::applyMask(const uint8_t row, const uint8_t min_col, const uint8_t max_col, const uint8_t mask, const uint8_t color)
+{
+    uint8_t*       frame = &getFrameBank(row)[min_col];
+    uint8_t* const limit = &getFrameBank(row)[max_col];
+
+    switch(color) {
+        case Traits::Color::WHITE:
+            do {
+                *frame &= ~mask;
+            } while(frame++ != limit);
+            break;
+        case Traits::Color::INVERSE:
+            do {
+                *frame ^= mask;
+            } while(frame++ != limit);
+            break;
+        default:
+            do {
+                *frame |= mask;
+            } while(frame++ != limit);
+            break;
+    }
+    markDirty(row, min_col, max_col);
+}
+
+void PCD8544::renderFill(const uint16_t offset, const uint8_t value, const uint16_t count)
+{
+    uint16_t bytes_left = count;
+    uint8_t  row        = (offset / Traits::Screen::MAX_COLS);
+    uint8_t  col        = (offset % Traits::Screen::MAX_COLS);
+
+    /* do not race an in-flight transfer */ {
+        waitIdle();
+    }
+    while(bytes_left != 0) {
+        uint8_t span = (Traits::Screen::MAX_COLS - col);
+        if(span > bytes_left) {
+            span = bytes_left;
+        }
+        /* fill frame buffer */ {
+            uint8_t* frame = &getFrameBank(row)[col];
+            ::memset(frame, value, span);
+            markDirty(row, col, (col + span - 1));
+        }
+        /* wrap like the controller does */ {
+            bytes_left -= span;
+            col = 0;
+            if(++row >= Traits::Screen::MAX_ROWS) {
+                row = 0;
+            }
+        }
+    }
+}
+
 // ---------------------------------------------------------------------------
 // End-Of-File
 // ---------------------------------------------------------------------------
@@ -19,6 +19,29 @@
 #ifndef __INO_PCD8544_PCD8544_h__
 #define __INO_PCD8544_PCD8544_h__
 
+#include "PCD8544_Transport.h"
+#include "PCD8544_Fonts.h"
+
+/*
+ * Runtime instrumentation, disabled by default. Define PCD8544_STATS to 1
+ * in the build flags (so that the library and the sketch agree) to enable
+ * the counters returned by PCD8544::getStats().
+ *
+ * The counters change the layout of PCD8544, so the class is declared in
+ * an inline namespace named after the flag: a sketch and a library built
+ * with different values fail to link instead of sharing a wrong layout.
+ */
+
+#ifndef PCD8544_STATS
+#define PCD8544_STATS 0
+#endif
+
+#if PCD8544_STATS
+#define PCD8544_STATS_NAMESPACE pcd8544_stats_enabled
+#else
+#define PCD8544_STATS_NAMESPACE pcd8544_stats_disabled
+#endif
+
 // ---------------------------------------------------------------------------
 // PCD8544_Traits
 // ---------------------------------------------------------------------------
@@ -33,6 +56,7 @@ struct PCD8544_Traits
         static constexpr uint8_t CSEL_PINMODE  = OUTPUT;
         static constexpr uint8_t RESET_PINMODE = OUTPUT;
         static constexpr uint8_t LIGHT_PINMODE = OUTPUT;
+        static constexpr uint8_t NO_PIN        = 0xff;
     };
 
     struct Screen
@@ -42,6 +66,88 @@ struct PCD8544_Traits
         static constexpr uint16_t BYTE_COUNT = (MAX_ROWS * MAX_COLS);
     };
 
+    struct Flush
+    {
+        static constexpr uint8_t  FRAMING_COST     = 1;
+        static constexpr uint8_t  ROW_ADDRESS_COST = 1;
+        static constexpr uint8_t  COL_ADDRESS_COST = 1;
+        static constexpr uint8_t  MODE_SWITCH_COST = 3;
+        static constexpr uint16_t NO_COST          = 0xffff;
+        static constexpr uint16_t NO_ADDRESS       = 0xffff;
+    };
+
+    struct Font
+    {
+        static constexpr uint16_t NO_GLYPH  = 0xffff;
+        static constexpr uint8_t  MIN_SCALE = 1;
+        static constexpr uint8_t  MAX_SCALE = 3;
+    };
+
+    struct Cells
+    {
+        static constexpr uint8_t COLS       = 14;
+        static constexpr uint8_t ROWS       = 6;
+        static constexpr uint8_t WIDTH      = 6;
+        static constexpr uint8_t CELL_COUNT = (COLS * ROWS);
+        static constexpr uint8_t BLANK      = ' ';
+    };
+
+    struct Field
+    {
+        static constexpr uint8_t MAX_WIDTH    = 14;
+        static constexpr uint8_t MAX_DIGITS   = 10;
+        static constexpr uint8_t MAX_DELTA    = 9;
+        static constexpr uint8_t OVERFLOW_CHR = '-';
+    };
+
+    struct Escape
+    {
+        static constexpr uint8_t ESC        = 0x1b;
+        static constexpr uint8_t STATE_NONE = 0;
+        static constexpr uint8_t STATE_ESC  = 1;
+        static constexpr uint8_t STATE_CSI  = 2;
+        static constexpr uint8_t MAX_PARAMS = 2;
+    };
+
+    struct Color
+    {
+        static constexpr uint8_t WHITE   = 0;
+        static constexpr uint8_t BLACK   = 1;
+        static constexpr uint8_t INVERSE = 2;
+    };
+
+    struct Blit
+    {
+        static constexpr uint8_t COPY    = 0;
+        static constexpr uint8_t OR      = 1;
+        static constexpr uint8_t AND_NOT = 2;
+        static constexpr uint8_t XOR     = 3;
+    };
+
+    struct Packed
+    {
+        static constexpr uint8_t OPCODE_MASK = 0xc0;
+        static constexpr uint8_t LENGTH_MASK = 0x3f;
+        static constexpr uint8_t LITERAL     = 0x00;
+        static constexpr uint8_t REPEAT      = 0x40;
+        static constexpr uint8_t SKIP        = 0x80;
+        static constexpr uint8_t END         = 0xc0;
+        static constexpr uint8_t MAX_RUN     = (LENGTH_MASK + 1);
+    };
+
+    struct Startup
+    {
+        static constexpr uint32_t RESET_PULSE_US = 2; /* datasheet minimum is 100ns */
+        static constexpr uint8_t  STEP_READY     = 0;
+        static constexpr uint8_t  STEP_RESET     = 1;
+        static constexpr uint8_t  STEP_FILL      = 2;
+    };
+
+    struct Control
+    {
+        static constexpr uint8_t UNKNOWN = 0xff;
+    };
+
     struct Initial
     {
         static constexpr uint8_t PREV_CHR = '\0';
@@ -52,6 +158,21 @@ struct PCD8544_Traits
     };
 };
 
+/*
+ * Packed images are a stream of opcodes covering the display RAM in
+ * horizontal order from the origin. The two upper bits of each opcode
+ * select the operation and the six lower bits hold the run length minus
+ * one (1 to 64 bytes):
+ *
+ *   LITERAL  followed by <length> bytes to copy
+ *   REPEAT   followed by one byte to write <length> times
+ *   SKIP     leaves <length> bytes unchanged
+ *   END      terminates the frame, the remaining bytes are unchanged
+ *
+ * A frame may also be a delta against the previous one, so an animation
+ * is simply a sequence of frames, each one ending with END.
+ */
+
 // ---------------------------------------------------------------------------
 // PCD8544_Wiring
 // ---------------------------------------------------------------------------
@@ -79,10 +200,114 @@ struct PCD8544_Cursor
     bool    wrap_col;
 };
 
+// ---------------------------------------------------------------------------
+// PCD8544_Text
+// ---------------------------------------------------------------------------
+
+struct PCD8544_Text
+{
+    const PCD8544_Font* font;
+    uint8_t             scale;
+    bool                console;
+    bool                reverse;
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_Escape
+// ---------------------------------------------------------------------------
+
+struct PCD8544_Escape
+{
+    uint8_t state;
+    uint8_t count;
+    uint8_t params[PCD8544_Traits::Escape::MAX_PARAMS];
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_State
+// ---------------------------------------------------------------------------
+
+struct PCD8544_State
+{
+    uint8_t function_set;
+    uint8_t display_control;
+    uint8_t temp_ctrl;
+    uint8_t bias_syst;
+    uint8_t volt_oper;
+    uint8_t ram_row;
+    uint8_t ram_col;
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_Startup
+// ---------------------------------------------------------------------------
+
+struct PCD8544_Startup
+{
+    uint8_t        step;
+    uint8_t        bank;
+    uint32_t       since;
+    const uint8_t* splash;
+    bool           pgm;
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_Frame
+// ---------------------------------------------------------------------------
+
+struct PCD8544_Frame
+{
+    uint8_t* buffer;
+    uint8_t* shadow;
+    bool     synced;
+    uint8_t  top;
+    uint8_t  dirty_min[PCD8544_Traits::Screen::MAX_ROWS];
+    uint8_t  dirty_max[PCD8544_Traits::Screen::MAX_ROWS];
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_Cells
+// ---------------------------------------------------------------------------
+
+struct PCD8544_Cells
+{
+    uint8_t* buffer;
+    uint16_t dirty[PCD8544_Traits::Cells::ROWS];
+    uint16_t reverse[PCD8544_Traits::Cells::ROWS];
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_Span
+// ---------------------------------------------------------------------------
+
+struct PCD8544_Span
+{
+    uint16_t begin;
+    uint16_t end;
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_Stats
+// ---------------------------------------------------------------------------
+
+struct PCD8544_Stats
+{
+    uint32_t data_bytes;
+    uint32_t commands;
+    uint32_t address_commands;
+    uint32_t flushes;
+    uint32_t bus_us;
+    uint32_t flush_us;
+};
+
 // ---------------------------------------------------------------------------
 // PCD8544
 // ---------------------------------------------------------------------------
 
+class PCD8544_Field;
+
+inline namespace PCD8544_STATS_NAMESPACE {
+
 class PCD8544
     : public Print
 {
@@ -94,15 +319,42 @@ public: // public interface
             , const uint8_t resetPin
             , const uint8_t lightPin );
 
-    virtual ~PCD8544() = default;
+    PCD8544 ( PCD8544_Transport& transport
+            , const uint8_t      resetPin
+            , const uint8_t      lightPin );
+
+    PCD8544 ( const PCD8544& ) = delete;
+
+    PCD8544& operator= ( const PCD8544& ) = delete;
+
+    virtual ~PCD8544();
 
     void begin();
     void reset();
     void end();
 
+    void beginAsync           ( const uint8_t* splash = nullptr
+                              , const bool     pgm = false );
+
+    bool poll                 ( );
+
+    bool isReady              ( ) const;
+
     void setCursor            ( const uint8_t row
                               , const uint8_t col );
 
+    void setFont              ( const PCD8544_Font& font );
+
+    const PCD8544_Font& getFont ( ) const;
+
+    void setTextScale         ( const uint8_t scale );
+
+    uint8_t getTextScale      ( ) const;
+
+    void setConsoleMode       ( const bool enabled );
+
+    bool getConsoleMode       ( ) const;
+
     void setContrast          ( const uint8_t level );
 
     void setBacklight         ( const uint8_t level );
@@ -111,12 +363,98 @@ public: // public interface
 
     void putImage             ( const uint8_t* image, const bool pgm );
 
+    void putImage             ( const uint8_t  row
+                              , const uint8_t  col
+                              , const uint8_t  width
+                              , const uint8_t  bankCount
+                              , const uint8_t* data
+                              , const bool     pgm );
+
+    const uint8_t* putPackedImage ( const uint8_t* data
+                                  , const bool     pgm );
+
+    void setFrameBuffer       ( uint8_t* buffer );
+
+    uint8_t* getFrameBuffer   ( ) const;
+
+    void setShadowBuffer      ( uint8_t* buffer );
+
+    uint8_t* getShadowBuffer  ( ) const;
+
+    void invalidate           ( );
+
+    void setCellBuffer        ( uint8_t* buffer );
+
+    uint8_t* getCellBuffer    ( ) const;
+
+    void refresh              ( );
+
+    void flush                ( );
+
+    bool busy                 ( ) const;
+
+    void waitIdle             ( );
+
+    PCD8544_Stats getStats    ( ) const;
+
+    void resetStats           ( );
+
+    void drawPixel            ( const int16_t x
+                              , const int16_t y
+                              , const uint8_t color );
+
+    void drawHLine            ( const int16_t x
+                              , const int16_t y
+                              , const int16_t w
+                              , const uint8_t color );
+
+    void drawVLine            ( const int16_t x
+                              , const int16_t y
+                              , const int16_t h
+                              , const uint8_t color );
+
+    void drawLine             ( const int16_t x0
+                              , const int16_t y0
+                              , const int16_t x1
+                              , const int16_t y1
+                              , const uint8_t color );
+
+    void drawRect             ( const int16_t x
+                              , const int16_t y
+                              , const int16_t w
+                              , const int16_t h
+                              , const uint8_t color );
+
+    void fillRect             ( const int16_t x
+                              , const int16_t y
+                              , const int16_t w
+                              , const int16_t h
+                              , const uint8_t color );
+
+    void drawCircle           ( const int16_t x0
+                              , const int16_t y0
+                              , const int16_t r
+                              , const uint8_t color );
+
+    void drawBitmap           ( const int16_t  x
+                              , const int16_t  y
+                              , const int16_t  w
+                              , const int16_t  h
+                              , const uint8_t* data
+                              , const bool     pgm
+                              , const uint8_t  mode
+                              , const uint8_t* mask = nullptr );
+
     void setStdInstructionSet ( );
 
     void setExtInstructionSet ( );
 
     void setPowerDownMode     ( );
 
+    void setHorizontalAddressing ( );
+
+    void setVerticalAddressing   ( );
+
     void setBlankMode         ( );
 
     void setBlackMode         ( );
@@ -139,18 +477,197 @@ public: // public interface
 
     void sendData             ( const uint8_t value );
 
+    void sendDataBurst        ( const uint8_t* data
+                              , const uint16_t count
+                              , const bool     pgm );
+
+    void fillData             ( const uint8_t  value
+                              , const uint16_t count );
+
     virtual size_t write      ( uint8_t character ) override;
 
+    virtual size_t write      ( const uint8_t* buffer
+                              , size_t         size ) override;
+
+    using Print::write;
+
 protected: // protected interface
-    using Traits = PCD8544_Traits;
-    using Wiring = PCD8544_Wiring;
-    using Cursor = PCD8544_Cursor;
+    friend class ::PCD8544_Field; /* draws through getGlyphWidth() and putGlyphsAt() only */
+
+    using Traits  = PCD8544_Traits;
+    using Wiring  = PCD8544_Wiring;
+    using Cursor  = PCD8544_Cursor;
+    using Text    = PCD8544_Text;
+    using Escape  = PCD8544_Escape;
+    using State   = PCD8544_State;
+    using Startup = PCD8544_Startup;
+    using Frame   = PCD8544_Frame;
+    using Cells   = PCD8544_Cells;
+    using Span    = PCD8544_Span;
+    using Stats   = PCD8544_Stats;
+
+    void setup                ( );
+
+    void resetState           ( );
+
+    void syncState            ( );
+
+    void configure            ( );
+
+    uint8_t getGlyph          ( const PCD8544_Font& font
+                              , const uint8_t       character
+                              , uint16_t&           offset ) const;
+
+    uint8_t getGlyphWidth     ( const PCD8544_Font& font
+                              , const uint8_t       scale
+                              , const uint8_t       character ) const;
+
+    uint8_t getLineHeight     ( ) const;
+
+    uint8_t expandGlyph       ( const uint8_t  value
+                              , const uint8_t  part ) const;
+
+    void putGlyphs            ( const uint8_t* chars
+                              , const uint8_t  count );
+
+    void putGlyphsAt          ( const uint8_t       row
+                              , const uint8_t       col
+                              , const uint8_t*      chars
+                              , const uint8_t       count
+                              , const PCD8544_Font& font
+                              , const uint8_t       scale
+                              , const uint8_t       padding );
+
+    void putBank              ( const uint8_t  row
+                              , const uint8_t  col
+                              , const uint8_t* bytes
+                              , const uint8_t  count );
+
+    void putCells             ( const uint8_t* chars
+                              , const uint8_t  count );
+
+    void setCell              ( const uint8_t  line
+                              , const uint8_t  cell
+                              , const uint8_t  character );
+
+    uint8_t renderCell        ( const uint8_t  line
+                              , const uint8_t  cell
+                              , uint8_t*       bytes ) const;
+
+    void fillBank             ( const uint8_t  row
+                              , const uint8_t  col
+                              , const uint8_t  value
+                              , const uint8_t  count );
+
+    void processEscape        ( const uint8_t character );
+
+    void moveToCell           ( const uint8_t line
+                              , const uint8_t cell );
+
+    void eraseDisplay         ( );
+
+    void eraseLine            ( );
+
+    void moveCursorRow        ( const uint8_t value );
+
+    void moveCursorCol        ( const uint8_t value );
+
+    void sendAddress          ( const uint8_t row
+                              , const uint8_t col );
+
+    uint8_t getAddressingMode ( ) const;
+
+    void updateState          ( const uint8_t value );
+
+    void advanceAddress       ( const uint16_t count );
+
+    void markDirty            ( const uint8_t row
+                              , const uint8_t min_col
+                              , const uint8_t max_col );
+
+    void clearDirty           ( );
+
+    bool getDirtyBounds       ( uint8_t& min_row
+                              , uint8_t& max_row
+                              , uint8_t& min_col
+                              , uint8_t& max_col ) const;
+
+    uint16_t addressCost      ( const uint16_t from
+                              , const uint16_t to ) const;
+
+    uint16_t horizontalCost   ( ) const;
+
+    uint16_t verticalCost     ( ) const;
+
+    bool columnChanged        ( const uint8_t col
+                              , const uint8_t min_row
+                              , const uint8_t max_row
+                              , const bool    diff ) const;
+
+    void flushHorizontal      ( const bool diff );
+
+    void flushVertical        ( const bool diff );
+
+    void flushColumns         ( const uint8_t  begin
+                              , const uint8_t  end
+                              , const uint8_t  min_row
+                              , const uint8_t  max_row );
+
+    void queueSpan            ( Span&          span
+                              , const uint16_t begin
+                              , const uint16_t end );
+
+    void flushSpan            ( Span&          span );
+
+    void queueFrame           ( const uint8_t* data
+                              , const uint16_t count );
+
+    uint8_t* getFrameBank     ( const uint8_t row ) const;
+
+    void scrollFrame          ( const uint8_t banks );
+
+    uint8_t scrollLines       ( const uint8_t row
+                              , const uint8_t height );
+
+    void renderData           ( const uint16_t offset
+                              , const uint8_t* data
+                              , const uint16_t count
+                              , const bool     pgm );
+
+    bool prepareFrame         ( );
+
+    void plotPixel            ( const int16_t  x
+                              , const int16_t  y
+                              , const uint8_t  color );
+
+    void applyMask            ( const uint8_t  row
+                              , const uint8_t  min_col
+                              , const uint8_t  max_col
+                              , const uint8_t  mask
+                              , const uint8_t  color );
+
+    void renderFill           ( const uint16_t offset
+                              , const uint8_t  value
+                              , const uint16_t count );
 
 protected: // protected data
-    Wiring const _wiring;
-    Cursor       _cursor;
+    Wiring const                 _wiring;
+    Cursor                       _cursor;
+    Text                         _text;
+    Escape                       _escape;
+    State                        _state;
+    Startup                      _startup;
+    Frame                        _frame;
+    Cells                        _cells;
+#if PCD8544_STATS
+    Stats                        _stats;
+#endif
+    PCD8544_SoftTransport* const _softTransport;
+    PCD8544_Transport&           _transport;
 };
 
+}
+
 // ---------------------------------------------------------------------------
 // End-Of-File
 // ---------------------------------------------------------------------------
@@ -0,0 +1,302 @@
+/*
+ * PCD8544_Field.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <Arduino.h>
+#include "PCD8544_Field.h"
+
+// ---------------------------------------------------------------------------
+// powers of ten, most significant first
+// ---------------------------------------------------------------------------
+
+namespace {
+
+const uint32_t powers_of_ten[PCD8544_Traits::Field::MAX_DIGITS] PROGMEM = {
+    1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL,
+    10000UL, 1000UL, 100UL, 10UL, 1UL
+};
+
+constexpr uint8_t NO_DOT = 0xff;
+
+}
+
+// ---------------------------------------------------------------------------
+// PCD8544_Field
+// ---------------------------------------------------------------------------
+
+PCD8544_Field::PCD8544_Field ( PCD8544&      screen
+                             , const uint8_t row
+                             , const uint8_t col
+                             , const uint8_t width
+                             , const uint8_t decimals )
+    : _screen(screen)
+    , _row(row)
+    , _col(col)
+    , _width(width == 0 ? 1 : (width < Traits::Field::MAX_WIDTH ? width : Traits::Field::MAX_WIDTH))
+    , _decimals(_width < 2 ? 0 : (decimals < (_width - 2) ? decimals : (_width - 2)))
+    , _font(nullptr)
+    , _scale(Traits::Font::MIN_SCALE)
+    , _magnitude(0)
+    , _negative(false)
+    , _valid(false)
+    , _length(1)
+    , _count(0)
+    , _digits()
+    , _chars()
+{
+}
+
+void PCD8544_Field::setFont(const PCD8544_Font& font, const uint8_t scale)
+{
+    _font  = &font;
+    _scale = (scale < Traits::Font::MIN_SCALE ? Traits::Font::MIN_SCALE : (scale > Traits::Font::MAX_SCALE ? Traits::Font::MAX_SCALE : scale));
+    _valid = false;
+}
+
+void PCD8544_Field::setValue(const int value)
+{
+    setValue(static_cast<long>(value));
+}
+
+void PCD8544_Field::setValue(const unsigned int value)
+{
+    setValue(static_cast<unsigned long>(value));
+}
+
+void PCD8544_Field::setValue(const long value)
+{
+    if(value < 0) {
+        update((0UL - static_cast<unsigned long>(value)), true);
+    }
+    else {
+        update(static_cast<unsigned long>(value), false);
+    }
+}
+
+void PCD8544_Field::setValue(const unsigned long value)
+{
+    update(value, false);
+}
+
+void PCD8544_Field::invalidate()
+{
+    _valid = false;
+}
+
+void PCD8544_Field::update(const uint32_t magnitude, const bool negative)
+{
+    /* small increments are applied to the cached digits */ {
+        if((negative != _negative) || (magnitude < _magnitude) || ((magnitude - _magnitude) > Traits::Field::MAX_DELTA)) {
+            convert(magnitude);
+        }
+        else if(magnitude != _magnitude) {
+            increment(magnitude - _magnitude);
+        }
+        else if(_valid != false) {
+            return;
+        }
+        _magnitude = magnitude;
+        _negative  = negative;
+    }
+    render();
+}
+
+void PCD8544_Field::convert(uint32_t magnitude)
+{
+    _length = 1;
+    for(uint8_t index = 0; index < Traits::Field::MAX_DIGITS; ++index) {
+        const uint32_t power = pgm_read_dword(&powers_of_ten[index]);
+        const uint8_t  place = (Traits::Field::MAX_DIGITS - 1 - index);
+        uint8_t        digit = 0;
+        while(magnitude >= power) {
+            magnitude -= power;
+            ++digit;
+        }
+        if((digit != 0) && (place >= _length)) {
+            _length = (place + 1);
+        }
+        _digits[place] = digit;
+    }
+}
+
+void PCD8544_Field::increment(const uint8_t delta)
+{
+    uint8_t carry = delta;
+    uint8_t place = 0;
+
+    /* the sum always fits, as the new magnitude does */
+    while((carry != 0) && (place < Traits::Field::MAX_DIGITS)) {
+        uint8_t digit = (_digits[place] + carry);
+        carry = 0;
+        if(digit >= 10) {
+            digit -= 10;
+            carry  = 1;
+        }
+        _digits[place++] = digit;
+    }
+    if(place > _length) {
+        _length = place;
+    }
+}
+
+void PCD8544_Field::format(uint8_t* chars) const
+{
+    const uint8_t dot    = getDotIndex();
+    const uint8_t digits = (_length > _decimals ? _length : (_decimals + 1));
+    const uint8_t needed = digits + (_decimals != 0 ? 1 : 0) + (_negative != false ? 1 : 0);
+    const bool    fits   = ((needed <= _count) && ((_decimals == 0) || (dot != NO_DOT)));
+    uint8_t       digit  = 0;
+    bool          sign   = _negative;
+
+    for(uint8_t index = _count; index-- != 0;) {
+        if(index == dot) {
+            chars[index] = '.';
+        }
+        else if(fits == false) {
+            chars[index] = Traits::Field::OVERFLOW_CHR;
+        }
+        else if(digit < digits) {
+            chars[index] = ('0' + _digits[digit++]);
+        }
+        else if(sign != false) {
+            chars[index] = '-';
+            sign = false;
+        }
+        else {
+            chars[index] = ' ';
+        }
+    }
+}
+
+void PCD8544_Field::render()
+{
+    uint8_t chars[Traits::Field::MAX_WIDTH];
+
+    /* the slots that fit on the line may change with the font */ {
+        const uint8_t count = getSlotCount();
+        if(count != _count) {
+            _count = count;
+            _valid = false;
+        }
+    }
+    /* send the runs of changed characters */ {
+        uint8_t index = 0;
+        format(chars);
+        while(index < _count) {
+            if((_valid != false) && (chars[index] == _chars[index])) {
+                ++index;
+                continue;
+            }
+            const uint8_t begin = index;
+            while((index < _count) && ((_valid == false) || (chars[index] != _chars[index]))) {
+                ++index;
+            }
+            renderRun(chars, begin, index);
+        }
+        ::memcpy(_chars, chars, _count);
+        _valid = true;
+    }
+}
+
+void PCD8544_Field::renderRun(const uint8_t* chars, const uint8_t begin, const uint8_t end)
+{
+    const PCD8544_Font& font  = getFont();
+    const uint8_t       scale = getScale();
+    uint8_t             first = begin;
+
+    /* glyphs that fill their slot are sent together, narrower ones are padded */
+    for(uint8_t index = begin; index < end; ++index) {
+        const uint8_t slot  = getSlotWidth(index);
+        uint8_t       width = getGlyphWidth(chars[index]);
+        if(width >= slot) {
+            if((index + 1) < end) {
+                continue;
+            }
+            width = slot;
+        }
+        _screen.putGlyphsAt(_row, getSlotCol(first), &chars[first], (index + 1 - first), font, scale, (slot - width));
+        first = (index + 1);
+    }
+}
+
+const PCD8544_Font& PCD8544_Field::getFont() const
+{
+    if(_font != nullptr) {
+        return *_font;
+    }
+    return _screen.getFont();
+}
+
+uint8_t PCD8544_Field::getScale() const
+{
+    if(_font != nullptr) {
+        return _scale;
+    }
+    return _screen.getTextScale();
+}
+
+uint8_t PCD8544_Field::getGlyphWidth(const uint8_t character) const
+{
+    return _screen.getGlyphWidth(getFont(), getScale(), character);
+}
+
+uint8_t PCD8544_Field::getSlotWidth(const uint8_t index) const
+{
+    return getGlyphWidth(index == getDotIndex() ? '.' : '0');
+}
+
+uint8_t PCD8544_Field::getSlotCount() const
+{
+    const uint8_t digit = getGlyphWidth('0');
+    const uint8_t dot   = getGlyphWidth('.');
+    uint8_t       count = _width;
+
+    /* the field is clipped to the slots that fit before the right edge */
+    while(count != 0) {
+        const bool     dotted = ((_decimals != 0) && (count >= (_decimals + 2)));
+        const uint16_t width  = (dotted != false ? (((count - 1) * digit) + dot) : (count * digit));
+        if((_col + width) <= Traits::Screen::MAX_COLS) {
+            break;
+        }
+        --count;
+    }
+    return count;
+}
+
+uint8_t PCD8544_Field::getSlotCol(const uint8_t index) const
+{
+    const uint8_t dot = getDotIndex();
+    uint8_t       col = (_col + (index * getSlotWidth(0)));
+
+    /* the decimal point has its own slot width */
+    if((dot != NO_DOT) && (index > dot)) {
+        col = (col + getSlotWidth(dot)) - getSlotWidth(0);
+    }
+    return col;
+}
+
+uint8_t PCD8544_Field::getDotIndex() const
+{
+    if((_decimals == 0) || (_count < (_decimals + 2))) {
+        return NO_DOT;
+    }
+    return (_count - _decimals - 1);
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
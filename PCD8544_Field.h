@@ -0,0 +1,119 @@
+/*
+ * PCD8544_Field.h - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INO_PCD8544_PCD8544_Field_h__
+#define __INO_PCD8544_PCD8544_Field_h__
+
+#include "PCD8544.h"
+
+// ---------------------------------------------------------------------------
+// PCD8544_Field
+// ---------------------------------------------------------------------------
+
+/*
+ * A numeric field is bound to a screen position and a width in characters.
+ * Values are right-aligned, optionally with a fixed number of decimals, and
+ * each character sits in a fixed slot as wide as the digit '0', so that a
+ * new value only sends the slots whose character actually changed.
+ *
+ * Values are converted without any division, small increments are even
+ * applied directly to the cached decimal digits. A value that does not fit
+ * is shown as a row of dashes. A field that would cross the right edge of
+ * the screen is narrowed to the slots that fit at the current font.
+ *
+ * The field renders with its own font if any, the screen font otherwise,
+ * at its own position: the text cursor of the screen is left untouched,
+ * and the field neither wraps nor scrolls the console.
+ */
+
+class PCD8544_Field
+{
+public: // public interface
+    PCD8544_Field ( PCD8544&      screen
+                  , const uint8_t row
+                  , const uint8_t col
+                  , const uint8_t width
+                  , const uint8_t decimals = 0 );
+
+    void setFont    ( const PCD8544_Font& font
+                    , const uint8_t       scale = 1 );
+
+    void setValue   ( const int           value );
+
+    void setValue   ( const unsigned int  value );
+
+    void setValue   ( const long          value );
+
+    void setValue   ( const unsigned long value );
+
+    void invalidate ( );
+
+protected: // protected interface
+    using Traits = PCD8544_Traits;
+
+    void update         ( const uint32_t magnitude
+                        , const bool     negative );
+
+    void convert        ( uint32_t magnitude );
+
+    void increment      ( const uint8_t delta );
+
+    void format         ( uint8_t* chars ) const;
+
+    void render         ( );
+
+    void renderRun      ( const uint8_t* chars
+                        , const uint8_t  begin
+                        , const uint8_t  end );
+
+    const PCD8544_Font& getFont ( ) const;
+
+    uint8_t getScale      ( ) const;
+
+    uint8_t getGlyphWidth ( const uint8_t character ) const;
+
+    uint8_t getSlotWidth  ( const uint8_t index ) const;
+
+    uint8_t getSlotCount  ( ) const;
+
+    uint8_t getSlotCol    ( const uint8_t index ) const;
+
+    uint8_t getDotIndex   ( ) const;
+
+protected: // protected data
+    PCD8544&            _screen;
+    uint8_t const       _row;
+    uint8_t const       _col;
+    uint8_t const       _width;
+    uint8_t const       _decimals;
+    const PCD8544_Font* _font;
+    uint8_t             _scale;
+    uint32_t            _magnitude;
+    bool                _negative;
+    bool                _valid;
+    uint8_t             _length;
+    uint8_t             _count;
+    uint8_t             _digits[PCD8544_Traits::Field::MAX_DIGITS];
+    uint8_t             _chars[PCD8544_Traits::Field::MAX_WIDTH];
+};
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
+
+#endif /* __INO_PCD8544_PCD8544_Field_h__ */
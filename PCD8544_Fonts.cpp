@@ -0,0 +1,355 @@
+/*
+ * PCD8544_Fonts.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <Arduino.h>
+#include "PCD8544_Fonts.h"
+
+// ---------------------------------------------------------------------------
+// PCD8544_Font6x8
+// ---------------------------------------------------------------------------
+
+namespace {
+
+const uint8_t font6x8_glyphs[96][6] PROGMEM = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 0x20 SPC */
+    { 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00 }, /* 0x21 !   */
+    { 0x00, 0x07, 0x00, 0x07, 0x00, 0x00 }, /* 0x22 "   */
+    { 0x14, 0x7f, 0x14, 0x7f, 0x14, 0x00 }, /* 0x23 #   */
+    { 0x24, 0x2a, 0x7f, 0x2a, 0x12, 0x00 }, /* 0x24 $   */
+    { 0x23, 0x13, 0x08, 0x64, 0x62, 0x00 }, /* 0x25 %   */
+    { 0x36, 0x49, 0x55, 0x22, 0x50, 0x00 }, /* 0x26 &   */
+    { 0x00, 0x05, 0x03, 0x00, 0x00, 0x00 }, /* 0x27 '   */
+    { 0x00, 0x1c, 0x22, 0x41, 0x00, 0x00 }, /* 0x28 (   */
+    { 0x00, 0x41, 0x22, 0x1c, 0x00, 0x00 }, /* 0x29 )   */
+    { 0x14, 0x08, 0x3e, 0x08, 0x14, 0x00 }, /* 0x2a *   */
+    { 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00 }, /* 0x2b +   */
+    { 0x00, 0x50, 0x30, 0x00, 0x00, 0x00 }, /* 0x2c ,   */
+    { 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 }, /* 0x2d -   */
+    { 0x00, 0x60, 0x60, 0x00, 0x00, 0x00 }, /* 0x2e .   */
+    { 0x20, 0x10, 0x08, 0x04, 0x02, 0x00 }, /* 0x2f /   */
+    { 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00 }, /* 0x30 0   */
+    { 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00 }, /* 0x31 1   */
+    { 0x42, 0x61, 0x51, 0x49, 0x46, 0x00 }, /* 0x32 2   */
+    { 0x21, 0x41, 0x45, 0x4b, 0x31, 0x00 }, /* 0x33 3   */
+    { 0x18, 0x14, 0x12, 0x7f, 0x10, 0x00 }, /* 0x34 4   */
+    { 0x27, 0x45, 0x45, 0x45, 0x39, 0x00 }, /* 0x35 5   */
+    { 0x3c, 0x4a, 0x49, 0x49, 0x30, 0x00 }, /* 0x36 6   */
+    { 0x01, 0x71, 0x09, 0x05, 0x03, 0x00 }, /* 0x37 7   */
+    { 0x36, 0x49, 0x49, 0x49, 0x36, 0x00 }, /* 0x38 8   */
+    { 0x06, 0x49, 0x49, 0x29, 0x1e, 0x00 }, /* 0x39 9   */
+    { 0x00, 0x36, 0x36, 0x00, 0x00, 0x00 }, /* 0x3a :   */
+    { 0x00, 0x56, 0x36, 0x00, 0x00, 0x00 }, /* 0x3b ;   */
+    { 0x08, 0x14, 0x22, 0x41, 0x00, 0x00 }, /* 0x3c <   */
+    { 0x14, 0x14, 0x14, 0x14, 0x14, 0x00 }, /* 0x3d =   */
+    { 0x00, 0x41, 0x22, 0x14, 0x08, 0x00 }, /* 0x3e >   */
+    { 0x02, 0x01, 0x51, 0x09, 0x06, 0x00 }, /* 0x3f ?   */
+    { 0x32, 0x49, 0x79, 0x41, 0x3e, 0x00 }, /* 0x40 @   */
+    { 0x7e, 0x11, 0x11, 0x11, 0x7e, 0x00 }, /* 0x41 A   */
+    { 0x7f, 0x49, 0x49, 0x49, 0x36, 0x00 }, /* 0x42 B   */
+    { 0x3e, 0x41, 0x41, 0x41, 0x22, 0x00 }, /* 0x43 C   */
+    { 0x7f, 0x41, 0x41, 0x22, 0x1c, 0x00 }, /* 0x44 D   */
+    { 0x7f, 0x49, 0x49, 0x49, 0x41, 0x00 }, /* 0x45 E   */
+    { 0x7f, 0x09, 0x09, 0x09, 0x01, 0x00 }, /* 0x46 F   */
+    { 0x3e, 0x41, 0x49, 0x49, 0x7a, 0x00 }, /* 0x47 G   */
+    { 0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00 }, /* 0x48 H   */
+    { 0x00, 0x41, 0x7f, 0x41, 0x00, 0x00 }, /* 0x49 I   */
+    { 0x20, 0x40, 0x41, 0x3f, 0x01, 0x00 }, /* 0x4a J   */
+    { 0x7f, 0x08, 0x14, 0x22, 0x41, 0x00 }, /* 0x4b K   */
+    { 0x7f, 0x40, 0x40, 0x40, 0x40, 0x00 }, /* 0x4c L   */
+    { 0x7f, 0x02, 0x0c, 0x02, 0x7f, 0x00 }, /* 0x4d M   */
+    { 0x7f, 0x04, 0x08, 0x10, 0x7f, 0x00 }, /* 0x4e N   */
+    { 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00 }, /* 0x4f O   */
+    { 0x7f, 0x09, 0x09, 0x09, 0x06, 0x00 }, /* 0x50 P   */
+    { 0x3e, 0x41, 0x51, 0x21, 0x5e, 0x00 }, /* 0x51 Q   */
+    { 0x7f, 0x09, 0x19, 0x29, 0x46, 0x00 }, /* 0x52 R   */
+    { 0x46, 0x49, 0x49, 0x49, 0x31, 0x00 }, /* 0x53 S   */
+    { 0x01, 0x01, 0x7f, 0x01, 0x01, 0x00 }, /* 0x54 T   */
+    { 0x3f, 0x40, 0x40, 0x40, 0x3f, 0x00 }, /* 0x55 U   */
+    { 0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00 }, /* 0x56 V   */
+    { 0x3f, 0x40, 0x38, 0x40, 0x3f, 0x00 }, /* 0x57 W   */
+    { 0x63, 0x14, 0x08, 0x14, 0x63, 0x00 }, /* 0x58 X   */
+    { 0x07, 0x08, 0x70, 0x08, 0x07, 0x00 }, /* 0x59 Y   */
+    { 0x61, 0x51, 0x49, 0x45, 0x43, 0x00 }, /* 0x5a Z   */
+    { 0x00, 0x7f, 0x41, 0x41, 0x00, 0x00 }, /* 0x5b [   */
+    { 0x02, 0x04, 0x08, 0x10, 0x20, 0x00 }, /* 0x5c \   */
+    { 0x00, 0x41, 0x41, 0x7f, 0x00, 0x00 }, /* 0x5d ]   */
+    { 0x04, 0x02, 0x01, 0x02, 0x04, 0x00 }, /* 0x5e ^   */
+    { 0x40, 0x40, 0x40, 0x40, 0x40, 0x00 }, /* 0x5f _   */
+    { 0x00, 0x01, 0x02, 0x04, 0x00, 0x00 }, /* 0x60 `   */
+    { 0x20, 0x54, 0x54, 0x54, 0x78, 0x00 }, /* 0x61 a   */
+    { 0x7f, 0x48, 0x44, 0x44, 0x38, 0x00 }, /* 0x62 b   */
+    { 0x38, 0x44, 0x44, 0x44, 0x20, 0x00 }, /* 0x63 c   */
+    { 0x38, 0x44, 0x44, 0x48, 0x7f, 0x00 }, /* 0x64 d   */
+    { 0x38, 0x54, 0x54, 0x54, 0x18, 0x00 }, /* 0x65 e   */
+    { 0x08, 0x7e, 0x09, 0x01, 0x02, 0x00 }, /* 0x66 f   */
+    { 0x0c, 0x52, 0x52, 0x52, 0x3e, 0x00 }, /* 0x67 g   */
+    { 0x7f, 0x08, 0x04, 0x04, 0x78, 0x00 }, /* 0x68 h   */
+    { 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00 }, /* 0x69 i   */
+    { 0x20, 0x40, 0x44, 0x3d, 0x00, 0x00 }, /* 0x6a j   */
+    { 0x7f, 0x10, 0x28, 0x44, 0x00, 0x00 }, /* 0x6b k   */
+    { 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00 }, /* 0x6c l   */
+    { 0x7c, 0x04, 0x18, 0x04, 0x78, 0x00 }, /* 0x6d m   */
+    { 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00 }, /* 0x6e n   */
+    { 0x38, 0x44, 0x44, 0x44, 0x38, 0x00 }, /* 0x6f o   */
+    { 0x7c, 0x14, 0x14, 0x14, 0x08, 0x00 }, /* 0x70 p   */
+    { 0x08, 0x14, 0x14, 0x18, 0x7c, 0x00 }, /* 0x71 q   */
+    { 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00 }, /* 0x72 r   */
+    { 0x48, 0x54, 0x54, 0x54, 0x20, 0x00 }, /* 0x73 s   */
+    { 0x04, 0x3f, 0x44, 0x40, 0x20, 0x00 }, /* 0x74 t   */
+    { 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00 }, /* 0x75 u   */
+    { 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00 }, /* 0x76 v   */
+    { 0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00 }, /* 0x77 w   */
+    { 0x44, 0x28, 0x10, 0x28, 0x44, 0x00 }, /* 0x78 x   */
+    { 0x0c, 0x50, 0x50, 0x50, 0x3c, 0x00 }, /* 0x79 y   */
+    { 0x44, 0x64, 0x54, 0x4c, 0x44, 0x00 }, /* 0x7a z   */
+    { 0x00, 0x08, 0x36, 0x41, 0x00, 0x00 }, /* 0x7b {   */
+    { 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00 }, /* 0x7c |   */
+    { 0x00, 0x41, 0x36, 0x08, 0x00, 0x00 }, /* 0x7d }   */
+    { 0x10, 0x08, 0x08, 0x10, 0x08, 0x00 }, /* 0x7e ~   */
+    { 0x7f, 0x55, 0x49, 0x55, 0x7f, 0x00 }  /* 0x7f     */
+};
+
+}
+
+const PCD8544_Font PCD8544_Font6x8 = {
+    0x20,
+    0x7f,
+    6,
+    1,
+    nullptr,
+    &font6x8_glyphs[0][0]
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_Font4x6
+// ---------------------------------------------------------------------------
+
+namespace {
+
+const uint8_t font4x6_glyphs[96][4] PROGMEM = {
+    { 0x00, 0x00, 0x00, 0x00 }, /* 0x20   */
+    { 0x00, 0x17, 0x00, 0x00 }, /* 0x21 ! */
+    { 0x03, 0x00, 0x03, 0x00 }, /* 0x22 " */
+    { 0x1f, 0x0a, 0x1f, 0x00 }, /* 0x23 # */
+    { 0x12, 0x1f, 0x09, 0x00 }, /* 0x24 $ */
+    { 0x09, 0x04, 0x12, 0x00 }, /* 0x25 % */
+    { 0x0a, 0x15, 0x1a, 0x00 }, /* 0x26 & */
+    { 0x00, 0x03, 0x00, 0x00 }, /* 0x27 ' */
+    { 0x00, 0x0e, 0x11, 0x00 }, /* 0x28 ( */
+    { 0x11, 0x0e, 0x00, 0x00 }, /* 0x29 ) */
+    { 0x0a, 0x04, 0x0a, 0x00 }, /* 0x2a * */
+    { 0x04, 0x0e, 0x04, 0x00 }, /* 0x2b + */
+    { 0x10, 0x08, 0x00, 0x00 }, /* 0x2c , */
+    { 0x04, 0x04, 0x04, 0x00 }, /* 0x2d - */
+    { 0x00, 0x10, 0x00, 0x00 }, /* 0x2e . */
+    { 0x18, 0x04, 0x03, 0x00 }, /* 0x2f / */
+    { 0x1f, 0x11, 0x1f, 0x00 }, /* 0x30 0 */
+    { 0x12, 0x1f, 0x10, 0x00 }, /* 0x31 1 */
+    { 0x1d, 0x15, 0x17, 0x00 }, /* 0x32 2 */
+    { 0x11, 0x15, 0x1f, 0x00 }, /* 0x33 3 */
+    { 0x07, 0x04, 0x1f, 0x00 }, /* 0x34 4 */
+    { 0x17, 0x15, 0x1d, 0x00 }, /* 0x35 5 */
+    { 0x1f, 0x15, 0x1d, 0x00 }, /* 0x36 6 */
+    { 0x01, 0x1d, 0x03, 0x00 }, /* 0x37 7 */
+    { 0x1f, 0x15, 0x1f, 0x00 }, /* 0x38 8 */
+    { 0x17, 0x15, 0x1f, 0x00 }, /* 0x39 9 */
+    { 0x00, 0x0a, 0x00, 0x00 }, /* 0x3a : */
+    { 0x10, 0x0a, 0x00, 0x00 }, /* 0x3b ; */
+    { 0x04, 0x0a, 0x11, 0x00 }, /* 0x3c < */
+    { 0x0a, 0x0a, 0x0a, 0x00 }, /* 0x3d = */
+    { 0x11, 0x0a, 0x04, 0x00 }, /* 0x3e > */
+    { 0x01, 0x15, 0x03, 0x00 }, /* 0x3f ? */
+    { 0x0f, 0x15, 0x17, 0x00 }, /* 0x40 @ */
+    { 0x1e, 0x05, 0x1e, 0x00 }, /* 0x41 A */
+    { 0x1f, 0x15, 0x0a, 0x00 }, /* 0x42 B */
+    { 0x0e, 0x11, 0x11, 0x00 }, /* 0x43 C */
+    { 0x1f, 0x11, 0x0e, 0x00 }, /* 0x44 D */
+    { 0x1f, 0x15, 0x15, 0x00 }, /* 0x45 E */
+    { 0x1f, 0x05, 0x05, 0x00 }, /* 0x46 F */
+    { 0x0e, 0x11, 0x1d, 0x00 }, /* 0x47 G */
+    { 0x1f, 0x04, 0x1f, 0x00 }, /* 0x48 H */
+    { 0x11, 0x1f, 0x11, 0x00 }, /* 0x49 I */
+    { 0x08, 0x10, 0x0f, 0x00 }, /* 0x4a J */
+    { 0x1f, 0x04, 0x1b, 0x00 }, /* 0x4b K */
+    { 0x1f, 0x10, 0x10, 0x00 }, /* 0x4c L */
+    { 0x1f, 0x02, 0x1f, 0x00 }, /* 0x4d M */
+    { 0x1f, 0x01, 0x1e, 0x00 }, /* 0x4e N */
+    { 0x0e, 0x11, 0x0e, 0x00 }, /* 0x4f O */
+    { 0x1f, 0x05, 0x02, 0x00 }, /* 0x50 P */
+    { 0x0e, 0x19, 0x1e, 0x00 }, /* 0x51 Q */
+    { 0x1f, 0x05, 0x1a, 0x00 }, /* 0x52 R */
+    { 0x12, 0x15, 0x09, 0x00 }, /* 0x53 S */
+    { 0x01, 0x1f, 0x01, 0x00 }, /* 0x54 T */
+    { 0x1f, 0x10, 0x1f, 0x00 }, /* 0x55 U */
+    { 0x0f, 0x10, 0x0f, 0x00 }, /* 0x56 V */
+    { 0x1f, 0x0c, 0x1f, 0x00 }, /* 0x57 W */
+    { 0x1b, 0x04, 0x1b, 0x00 }, /* 0x58 X */
+    { 0x03, 0x1c, 0x03, 0x00 }, /* 0x59 Y */
+    { 0x19, 0x15, 0x13, 0x00 }, /* 0x5a Z */
+    { 0x1f, 0x11, 0x00, 0x00 }, /* 0x5b [ */
+    { 0x03, 0x04, 0x18, 0x00 }, /* 0x5c \ */
+    { 0x00, 0x11, 0x1f, 0x00 }, /* 0x5d ] */
+    { 0x02, 0x01, 0x02, 0x00 }, /* 0x5e ^ */
+    { 0x10, 0x10, 0x10, 0x00 }, /* 0x5f _ */
+    { 0x01, 0x02, 0x00, 0x00 }, /* 0x60 ` */
+    { 0x0a, 0x16, 0x1c, 0x00 }, /* 0x61 a */
+    { 0x1f, 0x12, 0x0c, 0x00 }, /* 0x62 b */
+    { 0x0c, 0x12, 0x12, 0x00 }, /* 0x63 c */
+    { 0x0c, 0x12, 0x1f, 0x00 }, /* 0x64 d */
+    { 0x0c, 0x16, 0x14, 0x00 }, /* 0x65 e */
+    { 0x04, 0x1e, 0x05, 0x00 }, /* 0x66 f */
+    { 0x02, 0x15, 0x0f, 0x00 }, /* 0x67 g */
+    { 0x1f, 0x02, 0x1c, 0x00 }, /* 0x68 h */
+    { 0x00, 0x1d, 0x00, 0x00 }, /* 0x69 i */
+    { 0x08, 0x10, 0x0d, 0x00 }, /* 0x6a j */
+    { 0x1f, 0x0c, 0x12, 0x00 }, /* 0x6b k */
+    { 0x11, 0x1f, 0x10, 0x00 }, /* 0x6c l */
+    { 0x1e, 0x06, 0x1e, 0x00 }, /* 0x6d m */
+    { 0x1e, 0x02, 0x1c, 0x00 }, /* 0x6e n */
+    { 0x0c, 0x12, 0x0c, 0x00 }, /* 0x6f o */
+    { 0x1e, 0x0a, 0x04, 0x00 }, /* 0x70 p */
+    { 0x04, 0x0a, 0x1e, 0x00 }, /* 0x71 q */
+    { 0x1c, 0x02, 0x02, 0x00 }, /* 0x72 r */
+    { 0x10, 0x16, 0x0a, 0x00 }, /* 0x73 s */
+    { 0x02, 0x0f, 0x12, 0x00 }, /* 0x74 t */
+    { 0x0e, 0x10, 0x1e, 0x00 }, /* 0x75 u */
+    { 0x0e, 0x10, 0x0e, 0x00 }, /* 0x76 v */
+    { 0x1e, 0x18, 0x1e, 0x00 }, /* 0x77 w */
+    { 0x12, 0x0c, 0x12, 0x00 }, /* 0x78 x */
+    { 0x12, 0x14, 0x0e, 0x00 }, /* 0x79 y */
+    { 0x1a, 0x16, 0x16, 0x00 }, /* 0x7a z */
+    { 0x04, 0x1f, 0x11, 0x00 }, /* 0x7b { */
+    { 0x00, 0x1f, 0x00, 0x00 }, /* 0x7c | */
+    { 0x11, 0x1f, 0x04, 0x00 }, /* 0x7d } */
+    { 0x02, 0x06, 0x04, 0x00 }, /* 0x7e ~ */
+    { 0x1f, 0x1f, 0x1f, 0x00 }  /* 0x7f   */
+};
+
+}
+
+const PCD8544_Font PCD8544_Font4x6 = {
+    0x20,
+    0x7f,
+    4,
+    1,
+    nullptr,
+    &font4x6_glyphs[0][0]
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_Digits10x16
+// ---------------------------------------------------------------------------
+
+namespace {
+
+const uint16_t digits10x16_offsets[28] PROGMEM = {
+      0, /* 0x20 */
+      5, /* 0x21 */
+      5, /* 0x22 */
+      5, /* 0x23 */
+      5, /* 0x24 */
+      5, /* 0x25 */
+      5, /* 0x26 */
+      5, /* 0x27 */
+      5, /* 0x28 */
+      5, /* 0x29 */
+      5, /* 0x2a */
+      5, /* 0x2b */
+     13, /* 0x2c */
+     13, /* 0x2d */
+     21, /* 0x2e */
+     25, /* 0x2f */
+     35, /* 0x30 */
+     45, /* 0x31 */
+     55, /* 0x32 */
+     65, /* 0x33 */
+     75, /* 0x34 */
+     85, /* 0x35 */
+     95, /* 0x36 */
+    105, /* 0x37 */
+    115, /* 0x38 */
+    125, /* 0x39 */
+    135, /* 0x3a */
+    139  /* end  */
+};
+
+const uint8_t digits10x16_glyphs[] PROGMEM = {
+    /* 0x20   */
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2b + */
+    0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2d - */
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2e . */
+    0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0x00, 0x00,
+    /* 0x2f / */
+    0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0x00, 0x00,
+    0x30, 0x3c, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x30 0 */
+    0xfe, 0xff, 0x03, 0x03, 0x03, 0x03, 0xff, 0xfe, 0x00, 0x00,
+    0x1f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x1f, 0x00, 0x00,
+    /* 0x31 1 */
+    0x00, 0x04, 0x06, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00, 0x00,
+    /* 0x32 2 */
+    0x06, 0x87, 0xc3, 0xc3, 0xc3, 0xe3, 0x7f, 0x3e, 0x00, 0x00,
+    0x3f, 0x3f, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
+    /* 0x33 3 */
+    0x06, 0x07, 0xc3, 0xc3, 0xc3, 0xe3, 0xbf, 0x1e, 0x00, 0x00,
+    0x18, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x1f, 0x00, 0x00,
+    /* 0x34 4 */
+    0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00,
+    /* 0x35 5 */
+    0x7f, 0x7f, 0x63, 0x63, 0x63, 0x63, 0xe3, 0xc3, 0x00, 0x00,
+    0x18, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x1f, 0x00, 0x00,
+    /* 0x36 6 */
+    0xfe, 0xff, 0x63, 0x63, 0x63, 0x63, 0xe7, 0xc6, 0x00, 0x00,
+    0x1f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x1f, 0x00, 0x00,
+    /* 0x37 7 */
+    0x03, 0x03, 0x03, 0x03, 0xc3, 0xf3, 0x3f, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x38 8 */
+    0x9e, 0xff, 0x63, 0x63, 0x63, 0x63, 0xff, 0x9e, 0x00, 0x00,
+    0x1f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x1f, 0x00, 0x00,
+    /* 0x39 9 */
+    0x7e, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xfe, 0x00, 0x00,
+    0x18, 0x38, 0x30, 0x30, 0x30, 0x30, 0x3f, 0x1f, 0x00, 0x00,
+    /* 0x3a : */
+    0x30, 0x30, 0x00, 0x00,
+    0x0c, 0x0c, 0x00, 0x00
+};
+
+}
+
+const PCD8544_Font PCD8544_Digits10x16 = {
+    0x20,
+    0x3a,
+    0,
+    2,
+    digits10x16_offsets,
+    digits10x16_glyphs
+};
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
@@ -0,0 +1,69 @@
+/*
+ * PCD8544_Fonts.h - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INO_PCD8544_PCD8544_Fonts_h__
+#define __INO_PCD8544_PCD8544_Fonts_h__
+
+// ---------------------------------------------------------------------------
+// PCD8544_Font
+// ---------------------------------------------------------------------------
+
+/*
+ * A font covers the contiguous codepoint range [first, last]. Each glyph is
+ * stored in PROGMEM as `height` banks of `width` columns, bank after bank,
+ * the bit 0 of a column being its topmost pixel. Glyphs include their own
+ * spacing columns.
+ *
+ * Fixed-width fonts set `width` and leave `offsets` null. Proportional fonts
+ * set `width` to 0 and provide `offsets`, a PROGMEM table of (last - first
+ * + 2) column offsets, the width of a glyph being the difference between
+ * two consecutive offsets.
+ *
+ * Codepoints below `first` are rendered as blank cells of the width of the
+ * first glyph, codepoints above `last` are rendered with the last glyph.
+ */
+
+struct PCD8544_Font
+{
+    uint8_t         first;
+    uint8_t         last;
+    uint8_t         width;
+    uint8_t         height;
+    const uint16_t* offsets;
+    const uint8_t*  glyphs;
+};
+
+// ---------------------------------------------------------------------------
+// built-in fonts
+// ---------------------------------------------------------------------------
+
+/*
+ * PCD8544_Font6x8     : 0x20-0x7f, 6x8 cells, 14 columns x 6 lines (default)
+ * PCD8544_Font4x6     : 0x20-0x7f, 3x5 glyphs in 4x6 cells, 21 columns x 6 lines
+ * PCD8544_Digits10x16 : 0x20-0x3a, proportional two-bank digits, 8 digits x 3 lines
+ */
+
+extern const PCD8544_Font PCD8544_Font6x8;
+extern const PCD8544_Font PCD8544_Font4x6;
+extern const PCD8544_Font PCD8544_Digits10x16;
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
+
+#endif /* __INO_PCD8544_PCD8544_Fonts_h__ */
@@ -0,0 +1,809 @@
+/*
+ * PCD8544_Transport.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <Arduino.h>
+#include <SPI.h>
+#include "PCD8544_Transport.h"
+
+// ---------------------------------------------------------------------------
+// PCD8544_Transport
+// ---------------------------------------------------------------------------
+
+void PCD8544_Transport::queueData(const uint8_t* data, const uint16_t count)
+{
+    sendData(data, count, false);
+}
+
+bool PCD8544_Transport::busy() const
+{
+    return false;
+}
+
+void PCD8544_Transport::waitIdle()
+{
+}
+
+bool PCD8544_Transport::acquire()
+{
+    /* a dedicated controller is only driven through this transport */
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// PCD8544_SoftTransport
+// ---------------------------------------------------------------------------
+
+PCD8544_SoftTransport::PCD8544_SoftTransport ( const uint8_t sclkPin
+                                             , const uint8_t dataPin
+                                             , const uint8_t modePin
+                                             , const uint8_t cselPin )
+    : PCD8544_Transport()
+    , _sclkPin(sclkPin)
+    , _dataPin(dataPin)
+    , _modePin(modePin)
+    , _cselPin(cselPin)
+    , _modeLevel(0xff)
+{
+}
+
+void PCD8544_SoftTransport::begin()
+{
+    /* the d/c line level is unknown */ {
+        _modeLevel = 0xff;
+    }
+    /* setup */ {
+        ::pinMode(_sclkPin, OUTPUT);
+        ::pinMode(_dataPin, OUTPUT);
+        ::pinMode(_modePin, OUTPUT);
+        if(_cselPin != NO_PIN) {
+            ::pinMode(_cselPin, OUTPUT);
+        }
+    }
+    /* initial signals state */ {
+        setCsel(0x1);
+    }
+}
+
+void PCD8544_SoftTransport::end()
+{
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+}
+
+void PCD8544_SoftTransport::setMode(const uint8_t level)
+{
+    if(_modeLevel != level) {
+        ::digitalWrite(_modePin, level);
+        _modeLevel = level;
+    }
+}
+
+void PCD8544_SoftTransport::setCsel(const uint8_t level)
+{
+    if(_cselPin != NO_PIN) {
+        ::digitalWrite(_cselPin, level);
+    }
+}
+
+void PCD8544_SoftTransport::sendCommand(const uint8_t value)
+{
+    /* command mode */ {
+        setMode(0x0);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send command */ {
+        ::shiftOut(_dataPin, _sclkPin, MSBFIRST, value);
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+}
+
+void PCD8544_SoftTransport::sendData(const uint8_t* data, const uint16_t count, const bool pgm)
+{
+    if(count == 0) {
+        return;
+    }
+    /* data mode */ {
+        setMode(0x1);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send data */ {
+        const uint8_t* bytes = data;
+        uint16_t       bytes_left = count;
+        if(pgm != false) {
+            do {
+                ::shiftOut(_dataPin, _sclkPin, MSBFIRST, pgm_read_byte(bytes++));
+            } while(--bytes_left != 0);
+        }
+        else {
+            do {
+                ::shiftOut(_dataPin, _sclkPin, MSBFIRST, *bytes++);
+            } while(--bytes_left != 0);
+        }
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+}
+
+void PCD8544_SoftTransport::fillData(const uint8_t value, const uint16_t count)
+{
+    if(count == 0) {
+        return;
+    }
+    /* data mode */ {
+        setMode(0x1);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send data */ {
+        uint16_t bytes_left = count;
+        do {
+            ::shiftOut(_dataPin, _sclkPin, MSBFIRST, value);
+        } while(--bytes_left != 0);
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// PCD8544_SpiTransport
+// ---------------------------------------------------------------------------
+
+PCD8544_SpiTransport::PCD8544_SpiTransport ( const uint8_t  modePin
+                                           , const uint8_t  cselPin
+                                           , const uint32_t clock )
+    : PCD8544_Transport()
+    , _modePin(modePin)
+    , _cselPin(cselPin)
+    , _clock(clock)
+    , _modeLevel(0xff)
+{
+}
+
+void PCD8544_SpiTransport::begin()
+{
+    /* the d/c line level is unknown */ {
+        _modeLevel = 0xff;
+    }
+    /* setup */ {
+        ::pinMode(_modePin, OUTPUT);
+        if(_cselPin != NO_PIN) {
+            ::pinMode(_cselPin, OUTPUT);
+        }
+    }
+    /* initial signals state */ {
+        setCsel(0x1);
+    }
+    /* spi */ {
+        SPI.begin();
+    }
+}
+
+void PCD8544_SpiTransport::end()
+{
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+    /* spi */ {
+        SPI.end();
+    }
+}
+
+void PCD8544_SpiTransport::setMode(const uint8_t level)
+{
+    if(_modeLevel != level) {
+        ::digitalWrite(_modePin, level);
+        _modeLevel = level;
+    }
+}
+
+void PCD8544_SpiTransport::setCsel(const uint8_t level)
+{
+    if(_cselPin != NO_PIN) {
+        ::digitalWrite(_cselPin, level);
+    }
+}
+
+void PCD8544_SpiTransport::sendCommand(const uint8_t value)
+{
+    SPI.beginTransaction(SPISettings(_clock, MSBFIRST, SPI_MODE0));
+    /* command mode */ {
+        setMode(0x0);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send command */ {
+        SPI.transfer(value);
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+    SPI.endTransaction();
+}
+
+void PCD8544_SpiTransport::sendData(const uint8_t* data, const uint16_t count, const bool pgm)
+{
+    if(count == 0) {
+        return;
+    }
+    SPI.beginTransaction(SPISettings(_clock, MSBFIRST, SPI_MODE0));
+    /* data mode */ {
+        setMode(0x1);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send data */ {
+        const uint8_t* bytes = data;
+        uint16_t       bytes_left = count;
+        if(pgm != false) {
+            do {
+                SPI.transfer(pgm_read_byte(bytes++));
+            } while(--bytes_left != 0);
+        }
+        else {
+            do {
+                SPI.transfer(*bytes++);
+            } while(--bytes_left != 0);
+        }
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+    SPI.endTransaction();
+}
+
+void PCD8544_SpiTransport::fillData(const uint8_t value, const uint16_t count)
+{
+    if(count == 0) {
+        return;
+    }
+    SPI.beginTransaction(SPISettings(_clock, MSBFIRST, SPI_MODE0));
+    /* data mode */ {
+        setMode(0x1);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send data */ {
+        uint16_t bytes_left = count;
+        do {
+            SPI.transfer(value);
+        } while(--bytes_left != 0);
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+    SPI.endTransaction();
+}
+
+// ---------------------------------------------------------------------------
+// PCD8544_UsartTransport
+// ---------------------------------------------------------------------------
+
+#if defined(UBRR0) && defined(UMSEL01)
+
+namespace {
+
+inline void usart_send(const uint8_t value)
+{
+    while((UCSR0A & _BV(UDRE0)) == 0) {
+        continue;
+    }
+    UDR0 = value;
+}
+
+inline void usart_flush()
+{
+    while((UCSR0A & _BV(TXC0)) == 0) {
+        continue;
+    }
+}
+
+inline void usart_start()
+{
+    UCSR0A = _BV(TXC0);
+}
+
+}
+
+PCD8544_UsartTransport::PCD8544_UsartTransport ( const uint8_t  xck0Pin
+                                               , const uint8_t  modePin
+                                               , const uint8_t  cselPin
+                                               , const uint32_t clock )
+    : PCD8544_Transport()
+    , _xck0Pin(xck0Pin)
+    , _modePin(modePin)
+    , _cselPin(cselPin)
+    , _clock(clock)
+    , _modeLevel(0xff)
+{
+}
+
+void PCD8544_UsartTransport::begin()
+{
+    /* the d/c line level is unknown */ {
+        _modeLevel = 0xff;
+    }
+    /* setup */ {
+        ::pinMode(_xck0Pin, OUTPUT);
+        ::pinMode(_modePin, OUTPUT);
+        if(_cselPin != NO_PIN) {
+            ::pinMode(_cselPin, OUTPUT);
+        }
+    }
+    /* initial signals state */ {
+        setCsel(0x1);
+    }
+    /* usart in master spi mode, spi mode 0, msb first */ {
+        const uint32_t ubrr = (F_CPU / (2UL * _clock));
+        UBRR0  = 0;
+        UCSR0C = _BV(UMSEL01) | _BV(UMSEL00);
+        UCSR0B = _BV(TXEN0);
+        UBRR0  = (ubrr != 0 ? ubrr - 1 : 0);
+    }
+}
+
+void PCD8544_UsartTransport::end()
+{
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+    /* usart */ {
+        UCSR0B = 0;
+        UCSR0C = 0;
+    }
+}
+
+void PCD8544_UsartTransport::setMode(const uint8_t level)
+{
+    if(_modeLevel != level) {
+        ::digitalWrite(_modePin, level);
+        _modeLevel = level;
+    }
+}
+
+void PCD8544_UsartTransport::setCsel(const uint8_t level)
+{
+    if(_cselPin != NO_PIN) {
+        ::digitalWrite(_cselPin, level);
+    }
+}
+
+void PCD8544_UsartTransport::sendCommand(const uint8_t value)
+{
+    /* command mode */ {
+        setMode(0x0);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send command */ {
+        usart_start();
+        usart_send(value);
+        usart_flush();
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+}
+
+void PCD8544_UsartTransport::sendData(const uint8_t* data, const uint16_t count, const bool pgm)
+{
+    if(count == 0) {
+        return;
+    }
+    /* data mode */ {
+        setMode(0x1);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send data */ {
+        const uint8_t* bytes = data;
+        uint16_t       bytes_left = count;
+        usart_start();
+        if(pgm != false) {
+            do {
+                usart_send(pgm_read_byte(bytes++));
+            } while(--bytes_left != 0);
+        }
+        else {
+            do {
+                usart_send(*bytes++);
+            } while(--bytes_left != 0);
+        }
+        usart_flush();
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+}
+
+void PCD8544_UsartTransport::fillData(const uint8_t value, const uint16_t count)
+{
+    if(count == 0) {
+        return;
+    }
+    /* data mode */ {
+        setMode(0x1);
+    }
+    /* chip enable */ {
+        setCsel(0x0);
+    }
+    /* send data */ {
+        uint16_t bytes_left = count;
+        usart_start();
+        do {
+            usart_send(value);
+        } while(--bytes_left != 0);
+        usart_flush();
+    }
+    /* chip disable */ {
+        setCsel(0x1);
+    }
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// PCD8544_SpiAsyncTransport
+// ---------------------------------------------------------------------------
+
+#if defined(__AVR__) && defined(SPIE)
+
+namespace {
+
+PCD8544_SpiAsyncTransport* spi_async_transport = nullptr;
+
+}
+
+PCD8544_SpiAsyncTransport::PCD8544_SpiAsyncTransport ( const uint8_t  modePin
+                                                     , const uint8_t  cselPin
+                                                     , const uint32_t clock )
+    : PCD8544_Transport()
+    , _modePin(modePin)
+    , _cselPin(cselPin)
+    , _clock(clock)
+    , _modePort(nullptr)
+    , _modeMask(0)
+    , _cselPort(nullptr)
+    , _cselMask(0)
+    , _queue()
+    , _head(0)
+    , _tail(0)
+    , _running(false)
+{
+}
+
+void PCD8544_SpiAsyncTransport::begin()
+{
+    /* setup */ {
+        ::pinMode(_modePin, OUTPUT);
+        ::pinMode(_cselPin, OUTPUT);
+        _modePort = portOutputRegister(digitalPinToPort(_modePin));
+        _modeMask = digitalPinToBitMask(_modePin);
+        _cselPort = portOutputRegister(digitalPinToPort(_cselPin));
+        _cselMask = digitalPinToBitMask(_cselPin);
+    }
+    /* initial signals state */ {
+        ::digitalWrite(_cselPin, 0x1);
+    }
+    /* spi, kept in transaction and with the transfer complete interrupt */ {
+        SPI.begin();
+        SPI.beginTransaction(SPISettings(_clock, MSBFIRST, SPI_MODE0));
+        spi_async_transport = this;
+        SPCR |= _BV(SPIE);
+    }
+}
+
+void PCD8544_SpiAsyncTransport::end()
+{
+    /* wait for the queue */ {
+        waitIdle();
+    }
+    /* spi */ {
+        SPCR &= ~_BV(SPIE);
+        spi_async_transport = nullptr;
+        SPI.endTransaction();
+        SPI.end();
+    }
+}
+
+void PCD8544_SpiAsyncTransport::sendCommand(const uint8_t value)
+{
+    enqueue(nullptr, 1, value, FLAG_FILL);
+}
+
+void PCD8544_SpiAsyncTransport::sendData(const uint8_t* data, const uint16_t count, const bool pgm)
+{
+    if(count == 0) {
+        return;
+    }
+    enqueue(data, count, 0x00, (pgm != false ? FLAG_DATA | FLAG_PGM : FLAG_DATA));
+    waitIdle();
+}
+
+void PCD8544_SpiAsyncTransport::fillData(const uint8_t value, const uint16_t count)
+{
+    if(count == 0) {
+        return;
+    }
+    enqueue(nullptr, count, value, (FLAG_DATA | FLAG_FILL));
+}
+
+void PCD8544_SpiAsyncTransport::queueData(const uint8_t* data, const uint16_t count)
+{
+    if(count == 0) {
+        return;
+    }
+    enqueue(data, count, 0x00, FLAG_DATA);
+}
+
+bool PCD8544_SpiAsyncTransport::busy() const
+{
+    return _running;
+}
+
+void PCD8544_SpiAsyncTransport::waitIdle()
+{
+    while(_running != false) {
+        continue;
+    }
+}
+
+void PCD8544_SpiAsyncTransport::onInterrupt()
+{
+    if(spi_async_transport != nullptr) {
+        spi_async_transport->isr();
+    }
+}
+
+void PCD8544_SpiAsyncTransport::isr()
+{
+    Entry& entry = _queue[_head];
+
+    /* next byte of the current entry */ {
+        if(entry.count != 0) {
+            uint8_t value = entry.value;
+            if((entry.flags & FLAG_FILL) == 0) {
+                value = ((entry.flags & FLAG_PGM) != 0 ? pgm_read_byte(entry.data++) : *entry.data++);
+            }
+            --entry.count;
+            SPDR = value;
+            return;
+        }
+    }
+    /* next entry */ {
+        _head = ((_head + 1) % QUEUE_SIZE);
+        if(_head != _tail) {
+            startEntry();
+            return;
+        }
+    }
+    /* chip disable */ {
+        *_cselPort |= _cselMask;
+        _running = false;
+    }
+}
+
+void PCD8544_SpiAsyncTransport::enqueue(const uint8_t* data, const uint16_t count, const uint8_t value, const uint8_t flags)
+{
+    const uint8_t next = ((_tail + 1) % QUEUE_SIZE);
+
+    /* wait for a free slot */ {
+        while(next == _head) {
+            continue;
+        }
+    }
+    /* fill the slot */ {
+        Entry& entry = _queue[_tail];
+        entry.data  = data;
+        entry.count = count;
+        entry.value = value;
+        entry.flags = flags;
+    }
+    /* publish the slot and kick the transfer if idle */ {
+        const uint8_t sreg = SREG;
+        cli();
+        _tail = next;
+        if(_running == false) {
+            _running = true;
+            *_cselPort &= ~_cselMask;
+            startEntry();
+        }
+        SREG = sreg;
+    }
+}
+
+void PCD8544_SpiAsyncTransport::startEntry()
+{
+    Entry& entry = _queue[_head];
+
+    /* d/c is sampled with the last bit of each byte, switch it between bytes */ {
+        if((entry.flags & FLAG_DATA) != 0) {
+            *_modePort |= _modeMask;
+        }
+        else {
+            *_modePort &= ~_modeMask;
+        }
+    }
+    /* first byte */ {
+        uint8_t value = entry.value;
+        if((entry.flags & FLAG_FILL) == 0) {
+            value = ((entry.flags & FLAG_PGM) != 0 ? pgm_read_byte(entry.data++) : *entry.data++);
+        }
+        --entry.count;
+        SPDR = value;
+    }
+}
+
+#endif
+
+// ---------------------------------------------------------------------------
+// PCD8544_SharedBus
+// ---------------------------------------------------------------------------
+
+PCD8544_SharedBus::PCD8544_SharedBus ( PCD8544_Transport& wire
+                                     , const uint8_t      cselPin0
+                                     , const uint8_t      cselPin1
+                                     , const uint8_t      cselPin2
+                                     , const uint8_t      cselPin3 )
+    : _wire(wire)
+    , _cselPins { cselPin0, cselPin1, cselPin2, cselPin3 }
+    , _owners   { nullptr, nullptr, nullptr, nullptr }
+{
+}
+
+void PCD8544_SharedBus::begin()
+{
+    /* setup */ {
+        for(const uint8_t cselPin : _cselPins) {
+            if(cselPin != NO_PIN) {
+                ::pinMode(cselPin, OUTPUT);
+                ::digitalWrite(cselPin, 0x1);
+            }
+        }
+    }
+    /* wire */ {
+        _wire.begin();
+    }
+}
+
+void PCD8544_SharedBus::end()
+{
+    /* chip disable */ {
+        deselect(0xff);
+    }
+    /* wire */ {
+        _wire.end();
+    }
+}
+
+void PCD8544_SharedBus::select(const uint8_t mask, const PCD8544_PanelTransport* owner)
+{
+    /* the selected panels now reflect the owner */ {
+        static_cast<void>(acquire(mask, owner));
+    }
+    /* chip enable, all the selected panels at once */ {
+        for(uint8_t index = 0; index < MAX_PANELS; ++index) {
+            if(((mask & (1 << index)) != 0) && (_cselPins[index] != NO_PIN)) {
+                ::digitalWrite(_cselPins[index], 0x0);
+            }
+        }
+    }
+}
+
+void PCD8544_SharedBus::deselect(const uint8_t mask)
+{
+    for(uint8_t index = 0; index < MAX_PANELS; ++index) {
+        if(((mask & (1 << index)) != 0) && (_cselPins[index] != NO_PIN)) {
+            ::digitalWrite(_cselPins[index], 0x1);
+        }
+    }
+}
+
+bool PCD8544_SharedBus::acquire(const uint8_t mask, const PCD8544_PanelTransport* owner)
+{
+    bool owned = true;
+
+    for(uint8_t index = 0; index < MAX_PANELS; ++index) {
+        if(((mask & (1 << index)) != 0) && (_owners[index] != owner)) {
+            _owners[index] = owner;
+            owned = false;
+        }
+    }
+    return owned;
+}
+
+PCD8544_Transport& PCD8544_SharedBus::getWire() const
+{
+    return _wire;
+}
+
+// ---------------------------------------------------------------------------
+// PCD8544_PanelTransport
+// ---------------------------------------------------------------------------
+
+PCD8544_PanelTransport::PCD8544_PanelTransport ( PCD8544_SharedBus& bus
+                                               , const uint8_t      mask )
+    : PCD8544_Transport()
+    , _bus(bus)
+    , _mask(mask)
+{
+}
+
+void PCD8544_PanelTransport::begin()
+{
+    /* every display of the bus may begin it */ {
+        _bus.begin();
+    }
+}
+
+void PCD8544_PanelTransport::end()
+{
+    /* the wire stays up for the other panels */ {
+        _bus.deselect(_mask);
+    }
+}
+
+void PCD8544_PanelTransport::sendCommand(const uint8_t value)
+{
+    _bus.select(_mask, this);
+    _bus.getWire().sendCommand(value);
+    _bus.deselect(_mask);
+}
+
+void PCD8544_PanelTransport::sendData(const uint8_t* data, const uint16_t count, const bool pgm)
+{
+    if(count == 0) {
+        return;
+    }
+    _bus.select(_mask, this);
+    _bus.getWire().sendData(data, count, pgm);
+    _bus.deselect(_mask);
+}
+
+void PCD8544_PanelTransport::fillData(const uint8_t value, const uint16_t count)
+{
+    if(count == 0) {
+        return;
+    }
+    _bus.select(_mask, this);
+    _bus.getWire().fillData(value, count);
+    _bus.deselect(_mask);
+}
+
+bool PCD8544_PanelTransport::acquire()
+{
+    return _bus.acquire(_mask, this);
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
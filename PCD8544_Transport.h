@@ -0,0 +1,669 @@
+/*
+ * PCD8544_Transport.h - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INO_PCD8544_PCD8544_Transport_h__
+#define __INO_PCD8544_PCD8544_Transport_h__
+
+// ---------------------------------------------------------------------------
+// PCD8544_Transport
+// ---------------------------------------------------------------------------
+
+/*
+ * The transport is the wire protocol of the controller: it owns the D/C,
+ * CE, SCLK and DIN lines and frames every transfer. PCD8544 holds a
+ * reference to its transport and calls these virtual methods at runtime,
+ * the hot loops live inside the backend so that the virtual dispatch
+ * happens once per command or burst and never once per byte.
+ */
+
+class PCD8544_Transport
+{
+public: // public interface
+    static constexpr uint8_t NO_PIN = 0xff;
+
+    PCD8544_Transport() = default;
+
+    virtual ~PCD8544_Transport() = default;
+
+    virtual void begin       ( ) = 0;
+
+    virtual void end         ( ) = 0;
+
+    virtual void sendCommand ( const uint8_t  value ) = 0;
+
+    virtual void sendData    ( const uint8_t* data
+                             , const uint16_t count
+                             , const bool     pgm ) = 0;
+
+    virtual void fillData    ( const uint8_t  value
+                             , const uint16_t count ) = 0;
+
+    virtual void queueData   ( const uint8_t* data
+                             , const uint16_t count );
+
+    virtual bool busy        ( ) const;
+
+    virtual void waitIdle    ( );
+
+    virtual bool acquire     ( );
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_SoftTransport
+// ---------------------------------------------------------------------------
+
+/*
+ * Bit-banged backend using the Arduino core, works on any pin. The CE pin
+ * may be NO_PIN when the backend is the wire of a shared bus.
+ */
+
+class PCD8544_SoftTransport
+    : public PCD8544_Transport
+{
+public: // public interface
+    PCD8544_SoftTransport ( const uint8_t sclkPin
+                          , const uint8_t dataPin
+                          , const uint8_t modePin
+                          , const uint8_t cselPin );
+
+    virtual ~PCD8544_SoftTransport() = default;
+
+    virtual void begin       ( ) override;
+
+    virtual void end         ( ) override;
+
+    virtual void sendCommand ( const uint8_t  value ) override;
+
+    virtual void sendData    ( const uint8_t* data
+                             , const uint16_t count
+                             , const bool     pgm ) override;
+
+    virtual void fillData    ( const uint8_t  value
+                             , const uint16_t count ) override;
+
+protected: // protected interface
+    void setMode ( const uint8_t level );
+
+    void setCsel ( const uint8_t level );
+
+protected: // protected data
+    uint8_t const _sclkPin;
+    uint8_t const _dataPin;
+    uint8_t const _modePin;
+    uint8_t const _cselPin;
+    uint8_t       _modeLevel;
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_SpiTransport
+// ---------------------------------------------------------------------------
+
+/*
+ * Hardware SPI backend, SCLK and DIN must be wired to the SCK and MOSI
+ * pins of the board. The PCD8544 accepts a serial clock up to 4 MHz. The
+ * CE pin may be NO_PIN when the backend is the wire of a shared bus.
+ */
+
+class PCD8544_SpiTransport
+    : public PCD8544_Transport
+{
+public: // public interface
+    static constexpr uint32_t DEFAULT_CLOCK = 4000000UL;
+
+    PCD8544_SpiTransport ( const uint8_t  modePin
+                         , const uint8_t  cselPin
+                         , const uint32_t clock = DEFAULT_CLOCK );
+
+    virtual ~PCD8544_SpiTransport() = default;
+
+    virtual void begin       ( ) override;
+
+    virtual void end         ( ) override;
+
+    virtual void sendCommand ( const uint8_t  value ) override;
+
+    virtual void sendData    ( const uint8_t* data
+                             , const uint16_t count
+                             , const bool     pgm ) override;
+
+    virtual void fillData    ( const uint8_t  value
+                             , const uint16_t count ) override;
+
+protected: // protected interface
+    void setMode ( const uint8_t level );
+
+    void setCsel ( const uint8_t level );
+
+protected: // protected data
+    uint8_t  const _modePin;
+    uint8_t  const _cselPin;
+    uint32_t const _clock;
+    uint8_t        _modeLevel;
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_UsartTransport
+// ---------------------------------------------------------------------------
+
+/*
+ * USART0 in master SPI mode (AVR only), SCLK and DIN must be wired to the
+ * XCK0 and TXD0 pins. The transmit register is double-buffered, so bytes
+ * of a burst are sent back-to-back without any gap on the wire. The CE pin
+ * may be NO_PIN when the backend is the wire of a shared bus.
+ */
+
+#if defined(UBRR0) && defined(UMSEL01)
+
+class PCD8544_UsartTransport
+    : public PCD8544_Transport
+{
+public: // public interface
+    static constexpr uint32_t DEFAULT_CLOCK = 4000000UL;
+
+    PCD8544_UsartTransport ( const uint8_t  xck0Pin
+                           , const uint8_t  modePin
+                           , const uint8_t  cselPin
+                           , const uint32_t clock = DEFAULT_CLOCK );
+
+    virtual ~PCD8544_UsartTransport() = default;
+
+    virtual void begin       ( ) override;
+
+    virtual void end         ( ) override;
+
+    virtual void sendCommand ( const uint8_t  value ) override;
+
+    virtual void sendData    ( const uint8_t* data
+                             , const uint16_t count
+                             , const bool     pgm ) override;
+
+    virtual void fillData    ( const uint8_t  value
+                             , const uint16_t count ) override;
+
+protected: // protected interface
+    void setMode ( const uint8_t level );
+
+    void setCsel ( const uint8_t level );
+
+protected: // protected data
+    uint8_t  const _xck0Pin;
+    uint8_t  const _modePin;
+    uint8_t  const _cselPin;
+    uint32_t const _clock;
+    uint8_t        _modeLevel;
+};
+
+#endif
+
+// ---------------------------------------------------------------------------
+// PCD8544_SpiAsyncTransport
+// ---------------------------------------------------------------------------
+
+/*
+ * Interrupt-driven hardware SPI backend (AVR only). Commands and queued
+ * data are transmitted from the SPI transfer complete interrupt, CE stays
+ * asserted while the queue is not empty and D/C is switched between two
+ * bytes. queueData() returns immediately, the data must remain unchanged
+ * until busy() returns false. The SPI peripheral is owned by the display.
+ */
+
+#if defined(__AVR__) && defined(SPIE)
+
+class PCD8544_SpiAsyncTransport
+    : public PCD8544_Transport
+{
+public: // public interface
+    static constexpr uint32_t DEFAULT_CLOCK = 4000000UL;
+    static constexpr uint8_t  QUEUE_SIZE    = 8;
+
+    PCD8544_SpiAsyncTransport ( const uint8_t  modePin
+                              , const uint8_t  cselPin
+                              , const uint32_t clock = DEFAULT_CLOCK );
+
+    virtual ~PCD8544_SpiAsyncTransport() = default;
+
+    virtual void begin       ( ) override;
+
+    virtual void end         ( ) override;
+
+    virtual void sendCommand ( const uint8_t  value ) override;
+
+    virtual void sendData    ( const uint8_t* data
+                             , const uint16_t count
+                             , const bool     pgm ) override;
+
+    virtual void fillData    ( const uint8_t  value
+                             , const uint16_t count ) override;
+
+    virtual void queueData   ( const uint8_t* data
+                             , const uint16_t count ) override;
+
+    virtual bool busy        ( ) const override;
+
+    virtual void waitIdle    ( ) override;
+
+    void isr();
+
+    static void onInterrupt();
+
+protected: // protected interface
+    struct Entry
+    {
+        const uint8_t* data;
+        uint16_t       count;
+        uint8_t        value;
+        uint8_t        flags;
+    };
+
+    static constexpr uint8_t FLAG_DATA = 0x01;
+    static constexpr uint8_t FLAG_PGM  = 0x02;
+    static constexpr uint8_t FLAG_FILL = 0x04;
+
+    void enqueue    ( const uint8_t* data
+                    , const uint16_t count
+                    , const uint8_t  value
+                    , const uint8_t  flags );
+
+    void startEntry ( );
+
+protected: // protected data
+    uint8_t  const    _modePin;
+    uint8_t  const    _cselPin;
+    uint32_t const    _clock;
+    volatile uint8_t* _modePort;
+    uint8_t           _modeMask;
+    volatile uint8_t* _cselPort;
+    uint8_t           _cselMask;
+    Entry             _queue[QUEUE_SIZE];
+    volatile uint8_t  _head;
+    volatile uint8_t  _tail;
+    volatile bool     _running;
+};
+
+/*
+ * The SPI transfer complete vector is not defined by the library, so that
+ * it does not clash with another user of SPI_STC_vect: a sketch using this
+ * transport expands PCD8544_SPI_ASYNC_ISR() once, at file scope.
+ */
+
+#define PCD8544_SPI_ASYNC_ISR()                   \
+    ISR(SPI_STC_vect)                             \
+    {                                             \
+        PCD8544_SpiAsyncTransport::onInterrupt(); \
+    }
+
+#endif
+
+// ---------------------------------------------------------------------------
+// PCD8544_FastPin
+// ---------------------------------------------------------------------------
+
+/*
+ * Output pin resolved at compile time. On the ATmega48/88/168/328 family
+ * the port and the bit mask are constant expressions, so high() and low()
+ * compile down to a single sbi/cbi instruction. On other AVR the port and
+ * mask are looked up once in setup(), and elsewhere the Arduino core is
+ * used as a fallback.
+ */
+
+#if defined(__AVR_ATmega48__)   || defined(__AVR_ATmega48P__)  \
+ || defined(__AVR_ATmega88__)   || defined(__AVR_ATmega88P__)  \
+ || defined(__AVR_ATmega168__)  || defined(__AVR_ATmega168P__) \
+ || defined(__AVR_ATmega328__)  || defined(__AVR_ATmega328P__)
+#define PCD8544_FASTPIN_CONSTEXPR 1
+#endif
+
+template <uint8_t PIN>
+struct PCD8544_FastPin
+{
+#if defined(PCD8544_FASTPIN_CONSTEXPR)
+    static constexpr uint8_t PORT = (PIN <  8 ? 'D' : PIN < 14 ? 'B' : 'C');
+    static constexpr uint8_t BIT  = (PIN <  8 ? PIN : PIN < 14 ? PIN - 8 : PIN - 14);
+    static constexpr uint8_t MASK = (1 << BIT);
+
+    static_assert(PIN < 20, "invalid pin");
+
+    static inline void setup()
+    {
+        ::pinMode(PIN, OUTPUT);
+    }
+
+    static inline void high()
+    {
+        if(PORT == 'B') { PORTB |= MASK; }
+        if(PORT == 'C') { PORTC |= MASK; }
+        if(PORT == 'D') { PORTD |= MASK; }
+    }
+
+    static inline void low()
+    {
+        if(PORT == 'B') { PORTB &= ~MASK; }
+        if(PORT == 'C') { PORTC &= ~MASK; }
+        if(PORT == 'D') { PORTD &= ~MASK; }
+    }
+#elif defined(__AVR__)
+    static volatile uint8_t* _port;
+    static uint8_t           _mask;
+
+    static inline void setup()
+    {
+        ::pinMode(PIN, OUTPUT);
+        _port = portOutputRegister(digitalPinToPort(PIN));
+        _mask = digitalPinToBitMask(PIN);
+    }
+
+    static inline void high()
+    {
+        const uint8_t sreg = SREG;
+        cli();
+        *_port |= _mask;
+        SREG = sreg;
+    }
+
+    static inline void low()
+    {
+        const uint8_t sreg = SREG;
+        cli();
+        *_port &= ~_mask;
+        SREG = sreg;
+    }
+#else
+    static inline void setup()
+    {
+        ::pinMode(PIN, OUTPUT);
+    }
+
+    static inline void high()
+    {
+        ::digitalWrite(PIN, 0x1);
+    }
+
+    static inline void low()
+    {
+        ::digitalWrite(PIN, 0x0);
+    }
+#endif
+};
+
+#if !defined(PCD8544_FASTPIN_CONSTEXPR) && defined(__AVR__)
+template <uint8_t PIN>
+volatile uint8_t* PCD8544_FastPin<PIN>::_port = nullptr;
+
+template <uint8_t PIN>
+uint8_t PCD8544_FastPin<PIN>::_mask = 0;
+#endif
+
+// ---------------------------------------------------------------------------
+// PCD8544_FastTransport
+// ---------------------------------------------------------------------------
+
+/*
+ * Bit-banged backend specialized at compile time from a wiring traits
+ * structure providing SCLK_PIN, DATA_PIN, MODE_PIN and CSEL_PIN as static
+ * constants (see Shield_Wiring in the examples). The shift loop is fully
+ * unrolled, DIN is sampled by the controller on the rising edge of SCLK.
+ */
+
+template <typename WIRING>
+class PCD8544_FastTransport
+    : public PCD8544_Transport
+{
+public: // public interface
+    PCD8544_FastTransport()
+        : PCD8544_Transport()
+        , _modeLevel(0xff)
+    {
+    }
+
+    virtual ~PCD8544_FastTransport() = default;
+
+    virtual void begin() override
+    {
+        /* the d/c line level is unknown */ {
+            _modeLevel = 0xff;
+        }
+        /* setup */ {
+            Sclk::setup();
+            Data::setup();
+            Mode::setup();
+            Csel::setup();
+        }
+        /* initial signals state */ {
+            Sclk::low();
+            Csel::high();
+        }
+    }
+
+    virtual void end() override
+    {
+        /* chip disable */ {
+            Csel::high();
+        }
+    }
+
+    virtual void sendCommand(const uint8_t value) override
+    {
+        /* command mode */ {
+            setMode(0x0);
+        }
+        /* chip enable */ {
+            Csel::low();
+        }
+        /* send command */ {
+            shift(value);
+        }
+        /* chip disable */ {
+            Csel::high();
+        }
+    }
+
+    virtual void sendData(const uint8_t* data, const uint16_t count, const bool pgm) override
+    {
+        if(count == 0) {
+            return;
+        }
+        /* data mode */ {
+            setMode(0x1);
+        }
+        /* chip enable */ {
+            Csel::low();
+        }
+        /* send data */ {
+            const uint8_t* bytes = data;
+            uint16_t       bytes_left = count;
+            if(pgm != false) {
+                do {
+                    shift(pgm_read_byte(bytes++));
+                } while(--bytes_left != 0);
+            }
+            else {
+                do {
+                    shift(*bytes++);
+                } while(--bytes_left != 0);
+            }
+        }
+        /* chip disable */ {
+            Csel::high();
+        }
+    }
+
+    virtual void fillData(const uint8_t value, const uint16_t count) override
+    {
+        if(count == 0) {
+            return;
+        }
+        /* data mode */ {
+            setMode(0x1);
+        }
+        /* chip enable */ {
+            Csel::low();
+        }
+        /* send data */ {
+            uint16_t bytes_left = count;
+            do {
+                shift(value);
+            } while(--bytes_left != 0);
+        }
+        /* chip disable */ {
+            Csel::high();
+        }
+    }
+
+protected: // protected interface
+    using Sclk = PCD8544_FastPin<WIRING::SCLK_PIN>;
+    using Data = PCD8544_FastPin<WIRING::DATA_PIN>;
+    using Mode = PCD8544_FastPin<WIRING::MODE_PIN>;
+    using Csel = PCD8544_FastPin<WIRING::CSEL_PIN>;
+
+    inline void setMode(const uint8_t level)
+    {
+        if(_modeLevel != level) {
+            if(level != 0) {
+                Mode::high();
+            }
+            else {
+                Mode::low();
+            }
+            _modeLevel = level;
+        }
+    }
+
+    template <uint8_t MASK>
+    static inline void shiftBit(const uint8_t value)
+    {
+        if(value & MASK) {
+            Data::high();
+        }
+        else {
+            Data::low();
+        }
+        Sclk::high();
+        Sclk::low();
+    }
+
+    static inline void shift(const uint8_t value)
+    {
+        shiftBit<0x80>(value);
+        shiftBit<0x40>(value);
+        shiftBit<0x20>(value);
+        shiftBit<0x10>(value);
+        shiftBit<0x08>(value);
+        shiftBit<0x04>(value);
+        shiftBit<0x02>(value);
+        shiftBit<0x01>(value);
+    }
+
+protected: // protected data
+    uint8_t _modeLevel;
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_SharedBus
+// ---------------------------------------------------------------------------
+
+/*
+ * Several controllers sharing the SCLK, DIN and D/C lines, each one having
+ * its own CE line. The shared lines are driven by a synchronous backend,
+ * the wire, constructed with NO_PIN as CE pin. A transfer asserts the CE
+ * lines of all the selected panels at once, so that identical commands or
+ * data reach several panels in a single transfer.
+ *
+ * The bus also remembers which transport last drove each panel, so that a
+ * display can tell when its cached controller state has become stale.
+ */
+
+class PCD8544_PanelTransport;
+
+class PCD8544_SharedBus
+{
+public: // public interface
+    static constexpr uint8_t NO_PIN     = PCD8544_Transport::NO_PIN;
+    static constexpr uint8_t MAX_PANELS = 4;
+
+    PCD8544_SharedBus ( PCD8544_Transport& wire
+                      , const uint8_t      cselPin0
+                      , const uint8_t      cselPin1
+                      , const uint8_t      cselPin2 = NO_PIN
+                      , const uint8_t      cselPin3 = NO_PIN );
+
+    void begin    ( );
+
+    void end      ( );
+
+    void select   ( const uint8_t                 mask
+                  , const PCD8544_PanelTransport* owner );
+
+    void deselect ( const uint8_t                 mask );
+
+    bool acquire  ( const uint8_t                 mask
+                  , const PCD8544_PanelTransport* owner );
+
+    PCD8544_Transport& getWire ( ) const;
+
+protected: // protected data
+    PCD8544_Transport&            _wire;
+    uint8_t const                 _cselPins[MAX_PANELS];
+    const PCD8544_PanelTransport* _owners[MAX_PANELS];
+};
+
+// ---------------------------------------------------------------------------
+// PCD8544_PanelTransport
+// ---------------------------------------------------------------------------
+
+/*
+ * Transport to one or several panels of a shared bus, selected by a bit
+ * mask of panel indexes. A display on a mask of several panels broadcasts
+ * to all of them, e.g. to run a joint reset and initialization, or to
+ * drive mirrored panels. Displays on overlapping masks may be mixed, each
+ * of them resyncing its controller state after the other ones.
+ */
+
+class PCD8544_PanelTransport
+    : public PCD8544_Transport
+{
+public: // public interface
+    PCD8544_PanelTransport ( PCD8544_SharedBus& bus
+                           , const uint8_t      mask );
+
+    virtual ~PCD8544_PanelTransport() = default;
+
+    virtual void begin       ( ) override;
+
+    virtual void end         ( ) override;
+
+    virtual void sendCommand ( const uint8_t  value ) override;
+
+    virtual void sendData    ( const uint8_t* data
+                             , const uint16_t count
+                             , const bool     pgm ) override;
+
+    virtual void fillData    ( const uint8_t  value
+                             , const uint16_t count ) override;
+
+    virtual bool acquire     ( ) override;
+
+protected: // protected data
+    PCD8544_SharedBus& _bus;
+    uint8_t const      _mask;
+};
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
+
+#endif /* __INO_PCD8544_PCD8544_Transport_h__ */
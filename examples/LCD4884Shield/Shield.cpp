@@ -30,6 +30,8 @@ Shield::Shield()
               , Wiring::CSEL_PIN
               , Wiring::RESET_PIN
               , Wiring::LIGHT_PIN )
+    , _page(Page::MAIN)
+    , _cells()
 {
 }
 
@@ -47,25 +49,27 @@ void Shield::loop()
     const KeyValType    keyval = getKeyVal(keypad);
     const KeySymType    keysym = getKeySym(keyval);
     const KeyStrType    keystr = getKeyStr(keysym);
-    const unsigned long micros = ::micros();
-    const unsigned long millis = ::millis();
 
-    setCursor(0, 0);
-
-    println(F("** LCD 4884 **"  ));
-    println(F("~~~~~~~~~~~~~~"  ));
-    print  (F("              \r"));
-    print  (F("us: "            ));
-    println( (micros            ));
-    print  (F("              \r"));
-    print  (F("ms: "            ));
-    println( (millis            ));
-    print  (F("              \r"));
-    print  (F("keyval: "        ));
-    println( (keyval            ));
-    print  (F("              \r"));
-    print  (F("keysym: "        ));
-    println( (keystr            ));
+    /* left/right select the page */ {
+        uint8_t page = _page;
+        if(keysym == KeySym::KP_LEFT) {
+            page = Page::MAIN;
+        }
+        if(keysym == KeySym::KP_RIGHT) {
+            page = Page::STATS;
+        }
+        if(page != _page) {
+            _page = page;
+            clearDisplay();
+        }
+    }
+    if(_page == Page::STATS) {
+        showStats();
+    }
+    else {
+        showMain(keyval, keystr);
+    }
+    _screen.refresh();
 
     ::delay(Config::LOOP_DELAY);
 }
@@ -185,6 +189,55 @@ void Shield::initKeypad()
 void Shield::initScreen()
 {
     _screen.begin();
+    _screen.setCellBuffer(_cells);
+}
+
+void Shield::showMain(const KeyValType keyval, const KeyStrType keystr)
+{
+    const unsigned long micros = ::micros();
+    const unsigned long millis = ::millis();
+
+    setCursor(0, 0);
+
+    println(F("** LCD 4884 **"  ));
+    println(F("~~~~~~~~~~~~~~"  ));
+    print  (F("us: "            ));
+    print  ( (micros            ));
+    println(F("\033[K"          ));
+    print  (F("ms: "            ));
+    print  ( (millis            ));
+    println(F("\033[K"          ));
+    print  (F("keyval: "        ));
+    print  ( (keyval            ));
+    println(F("\033[K"          ));
+    print  (F("keysym: "        ));
+    print  ( (keystr            ));
+    println(F("\033[K"          ));
+}
+
+void Shield::showStats()
+{
+    const PCD8544_Stats stats = _screen.getStats();
+
+    setCursor(0, 0);
+
+    print  (F("** STATS **"     ));
+    println(F("\033[K"          ));
+    print  (F("bytes: "         ));
+    print  ( (stats.data_bytes  ));
+    println(F("\033[K"          ));
+    print  (F("cmds: "          ));
+    print  ( (stats.commands    ));
+    println(F("\033[K"          ));
+    print  (F("addr: "          ));
+    print  ( (stats.address_commands));
+    println(F("\033[K"          ));
+    print  (F("flush: "         ));
+    print  ( (stats.flushes     ));
+    println(F("\033[K"          ));
+    print  (F("bus us: "        ));
+    print  ( (stats.bus_us      ));
+    println(F("\033[K"          ));
 }
 
 size_t Shield::write(uint8_t character)
@@ -192,6 +245,11 @@ size_t Shield::write(uint8_t character)
     return _screen.write(character);
 }
 
+size_t Shield::write(const uint8_t* buffer, size_t size)
+{
+    return _screen.write(buffer, size);
+}
+
 // ---------------------------------------------------------------------------
 // End-Of-File
 // ---------------------------------------------------------------------------
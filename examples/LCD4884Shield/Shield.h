@@ -75,6 +75,12 @@ struct Shield_Traits
     {
         static constexpr unsigned long LOOP_DELAY = 100UL;
     };
+
+    struct Page
+    {
+        static constexpr uint8_t MAIN  = 0;
+        static constexpr uint8_t STATS = 1;
+    };
 };
 
 // ---------------------------------------------------------------------------
@@ -122,16 +128,28 @@ public: // public interface
 
     virtual size_t write(uint8_t character) override;
 
+    virtual size_t write(const uint8_t* buffer, size_t size) override;
+
+    using Print::write;
+
 protected: // protected interface
     using Traits = Shield_Traits;
     using Wiring = Shield_Wiring;
     using Config = Traits::Config;
+    using Page   = Traits::Page;
 
     void initKeypad();
     void initScreen();
 
+    void showMain  ( const KeyValType keyval
+                   , const KeyStrType keystr );
+
+    void showStats ( );
+
 protected: // protected data
     PCD8544 _screen;
+    uint8_t _page;
+    uint8_t _cells[PCD8544_Traits::Cells::CELL_COUNT];
 };
 
 // ---------------------------------------------------------------------------
@@ -0,0 +1,385 @@
+/*
+ * Arduino.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include "Arduino.h"
+#include "SPI.h"
+
+// ---------------------------------------------------------------------------
+// host board
+// ---------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint8_t MAX_OBSERVERS = 8;
+
+struct Board
+{
+    uint8_t            pin_level[NUM_PINS];
+    int                analog[NUM_PINS];
+    unsigned long      time_us;
+    host::PinObserver* observers[MAX_OBSERVERS];
+    host::Counters     counters;
+};
+
+Board board = {
+    {},
+    { 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023
+    , 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023
+    , 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023
+    , 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023 },
+    0,
+    {},
+    {}
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// core functions
+// ---------------------------------------------------------------------------
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    static_cast<void>(pin);
+    static_cast<void>(mode);
+    ++board.counters.pin_modes;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+    ++board.counters.digital_writes;
+    if(pin >= NUM_PINS) {
+        return;
+    }
+    level = (level != LOW ? HIGH : LOW);
+    if(board.pin_level[pin] == level) {
+        return;
+    }
+    board.pin_level[pin] = level;
+    for(host::PinObserver* observer : board.observers) {
+        if(observer != nullptr) {
+            observer->pinChanged(pin, level);
+        }
+    }
+}
+
+int digitalRead(uint8_t pin)
+{
+    if(pin >= NUM_PINS) {
+        return LOW;
+    }
+    return board.pin_level[pin];
+}
+
+int analogRead(uint8_t pin)
+{
+    if(pin >= NUM_PINS) {
+        return 0;
+    }
+    return board.analog[pin];
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+    static_cast<void>(pin);
+    static_cast<void>(value);
+    ++board.counters.analog_writes;
+}
+
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t value)
+{
+    ++board.counters.shift_outs;
+    for(uint8_t bit = 0; bit < 8; ++bit) {
+        if(bitOrder == LSBFIRST) {
+            digitalWrite(dataPin, (value & 0x01));
+            value >>= 1;
+        }
+        else {
+            digitalWrite(dataPin, ((value & 0x80) != 0));
+            value <<= 1;
+        }
+        digitalWrite(clockPin, HIGH);
+        digitalWrite(clockPin, LOW);
+    }
+}
+
+unsigned long millis()
+{
+    return (micros() / 1000UL);
+}
+
+unsigned long micros()
+{
+    /* time always moves forward, so that busy loops terminate */
+    return ++board.time_us;
+}
+
+void delay(unsigned long ms)
+{
+    board.time_us += (ms * 1000UL);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    board.time_us += us;
+}
+
+void noInterrupts()
+{
+}
+
+void interrupts()
+{
+}
+
+// ---------------------------------------------------------------------------
+// Print
+// ---------------------------------------------------------------------------
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+    size_t count = 0;
+    while(size-- != 0) {
+        count += write(*buffer++);
+    }
+    return count;
+}
+
+size_t Print::write(const char* string)
+{
+    if(string == nullptr) {
+        return 0;
+    }
+    return write(reinterpret_cast<const uint8_t*>(string), strlen(string));
+}
+
+size_t Print::write(const char* buffer, size_t size)
+{
+    return write(reinterpret_cast<const uint8_t*>(buffer), size);
+}
+
+size_t Print::print(const __FlashStringHelper* string)
+{
+    const char* chars = reinterpret_cast<const char*>(string);
+    size_t      count = 0;
+
+    /* like the AVR core, flash strings are written one character at a time */
+    while(pgm_read_byte(chars) != '\0') {
+        count += write(static_cast<uint8_t>(pgm_read_byte(chars++)));
+    }
+    return count;
+}
+
+size_t Print::print(const char* string)
+{
+    return write(string);
+}
+
+size_t Print::print(char character)
+{
+    return write(static_cast<uint8_t>(character));
+}
+
+size_t Print::print(unsigned char value, int base)
+{
+    return print(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(int value, int base)
+{
+    return print(static_cast<long>(value), base);
+}
+
+size_t Print::print(unsigned int value, int base)
+{
+    return print(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(long value, int base)
+{
+    if((base == DEC) && (value < 0)) {
+        return write('-') + printNumber(static_cast<unsigned long>(-value), DEC);
+    }
+    return printNumber(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+    return printNumber(value, base);
+}
+
+size_t Print::println()
+{
+    return write("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper* string)
+{
+    return print(string) + println();
+}
+
+size_t Print::println(const char* string)
+{
+    return print(string) + println();
+}
+
+size_t Print::println(char character)
+{
+    return print(character) + println();
+}
+
+size_t Print::println(unsigned char value, int base)
+{
+    return print(value, base) + println();
+}
+
+size_t Print::println(int value, int base)
+{
+    return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base)
+{
+    return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base)
+{
+    return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base)
+{
+    return print(value, base) + println();
+}
+
+size_t Print::printNumber(unsigned long value, uint8_t base)
+{
+    char  buffer[8 * sizeof(long) + 1];
+    char* string = &buffer[sizeof(buffer) - 1];
+
+    if(base < 2) {
+        base = DEC;
+    }
+    *string = '\0';
+    do {
+        const unsigned long digit = (value % base);
+        value /= base;
+        *--string = static_cast<char>(digit < 10 ? '0' + digit : 'A' + digit - 10);
+    } while(value != 0);
+
+    return write(string);
+}
+
+// ---------------------------------------------------------------------------
+// Serial
+// ---------------------------------------------------------------------------
+
+HardwareSerial Serial;
+
+void HardwareSerial::begin(unsigned long speed)
+{
+    static_cast<void>(speed);
+}
+
+void HardwareSerial::end()
+{
+}
+
+size_t HardwareSerial::write(uint8_t character)
+{
+    return (::fputc(character, stdout) != EOF ? 1 : 0);
+}
+
+// ---------------------------------------------------------------------------
+// SPI
+// ---------------------------------------------------------------------------
+
+SPIClass SPI;
+
+// ---------------------------------------------------------------------------
+// host extensions
+// ---------------------------------------------------------------------------
+
+namespace host {
+
+void attach(PinObserver* observer)
+{
+    for(PinObserver*& slot : board.observers) {
+        if(slot == nullptr) {
+            slot = observer;
+            return;
+        }
+    }
+}
+
+void detach(PinObserver* observer)
+{
+    for(PinObserver*& slot : board.observers) {
+        if(slot == observer) {
+            slot = nullptr;
+        }
+    }
+}
+
+void notifySpi(uint8_t value)
+{
+    ++board.counters.spi_transfers;
+    for(PinObserver* observer : board.observers) {
+        if(observer != nullptr) {
+            observer->spiTransfer(value);
+        }
+    }
+}
+
+void setAnalog(uint8_t pin, int value)
+{
+    if(pin < NUM_PINS) {
+        board.analog[pin] = value;
+    }
+}
+
+uint8_t getPinLevel(uint8_t pin)
+{
+    if(pin >= NUM_PINS) {
+        return LOW;
+    }
+    return board.pin_level[pin];
+}
+
+const Counters& getCounters()
+{
+    return board.counters;
+}
+
+void resetCounters()
+{
+    board.counters = Counters();
+}
+
+void advanceTime(unsigned long us)
+{
+    board.time_us += us;
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
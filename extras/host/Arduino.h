@@ -0,0 +1,192 @@
+/*
+ * Arduino.h - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INO_PCD8544_HOST_Arduino_h__
+#define __INO_PCD8544_HOST_Arduino_h__
+
+/*
+ * Host stand-in for the subset of the Arduino core used by the library
+ * and its examples. Pin writes are forwarded to the attached observers
+ * (see PCD8544_Emulator) and the core calls are counted.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+// core constants
+// ---------------------------------------------------------------------------
+
+#define LOW         0x0
+#define HIGH        0x1
+#define INPUT       0x0
+#define OUTPUT      0x1
+#define LSBFIRST    0
+#define MSBFIRST    1
+#define NOT_A_PIN   0
+#define NUM_PINS    32
+#define A0          14
+#define A1          15
+#define A2          16
+#define A3          17
+#define A4          18
+#define A5          19
+#define F_CPU       16000000UL
+
+typedef uint8_t byte;
+
+// ---------------------------------------------------------------------------
+// program memory
+// ---------------------------------------------------------------------------
+
+#define PROGMEM
+#define PSTR(string)               (string)
+#define pgm_read_byte(address)     (*reinterpret_cast<const uint8_t*>(address))
+#define pgm_read_word(address)     (*reinterpret_cast<const uint16_t*>(address))
+#define pgm_read_dword(address)    (*reinterpret_cast<const uint32_t*>(address))
+#define pgm_read_ptr(address)      (*reinterpret_cast<const void* const*>(address))
+#define memcpy_P(dst, src, count)  memcpy((dst), (src), (count))
+#define strlen_P(string)           strlen(string)
+
+class __FlashStringHelper;
+
+#define F(string) (reinterpret_cast<const __FlashStringHelper*>(PSTR(string)))
+
+// ---------------------------------------------------------------------------
+// core functions
+// ---------------------------------------------------------------------------
+
+void          pinMode           ( uint8_t pin, uint8_t mode );
+void          digitalWrite      ( uint8_t pin, uint8_t level );
+int           digitalRead       ( uint8_t pin );
+int           analogRead        ( uint8_t pin );
+void          analogWrite       ( uint8_t pin, int value );
+void          shiftOut          ( uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t value );
+unsigned long millis            ( );
+unsigned long micros            ( );
+void          delay             ( unsigned long ms );
+void          delayMicroseconds ( unsigned int us );
+void          noInterrupts      ( );
+void          interrupts        ( );
+
+// ---------------------------------------------------------------------------
+// Print
+// ---------------------------------------------------------------------------
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print
+{
+public: // public interface
+    Print() = default;
+
+    virtual ~Print() = default;
+
+    virtual size_t write ( uint8_t character ) = 0;
+
+    virtual size_t write ( const uint8_t* buffer, size_t size );
+
+    size_t write   ( const char* string );
+    size_t write   ( const char* buffer, size_t size );
+
+    size_t print   ( const __FlashStringHelper* string );
+    size_t print   ( const char* string );
+    size_t print   ( char character );
+    size_t print   ( unsigned char value, int base = DEC );
+    size_t print   ( int value, int base = DEC );
+    size_t print   ( unsigned int value, int base = DEC );
+    size_t print   ( long value, int base = DEC );
+    size_t print   ( unsigned long value, int base = DEC );
+
+    size_t println ( );
+    size_t println ( const __FlashStringHelper* string );
+    size_t println ( const char* string );
+    size_t println ( char character );
+    size_t println ( unsigned char value, int base = DEC );
+    size_t println ( int value, int base = DEC );
+    size_t println ( unsigned int value, int base = DEC );
+    size_t println ( long value, int base = DEC );
+    size_t println ( unsigned long value, int base = DEC );
+
+protected: // protected interface
+    size_t printNumber ( unsigned long value, uint8_t base );
+};
+
+// ---------------------------------------------------------------------------
+// Serial
+// ---------------------------------------------------------------------------
+
+class HardwareSerial
+    : public Print
+{
+public: // public interface
+    void begin ( unsigned long speed );
+
+    void end   ( );
+
+    virtual size_t write ( uint8_t character ) override;
+
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+// ---------------------------------------------------------------------------
+// host extensions
+// ---------------------------------------------------------------------------
+
+namespace host {
+
+struct PinObserver
+{
+    virtual ~PinObserver() = default;
+
+    virtual void pinChanged  ( uint8_t pin, uint8_t level ) = 0;
+
+    virtual void spiTransfer ( uint8_t value ) = 0;
+};
+
+struct Counters
+{
+    uint32_t pin_modes;
+    uint32_t digital_writes;
+    uint32_t analog_writes;
+    uint32_t shift_outs;
+    uint32_t spi_transfers;
+};
+
+void            attach        ( PinObserver* observer );
+void            detach        ( PinObserver* observer );
+void            notifySpi     ( uint8_t value );
+void            setAnalog     ( uint8_t pin, int value );
+uint8_t         getPinLevel   ( uint8_t pin );
+const Counters& getCounters   ( );
+void            resetCounters ( );
+void            advanceTime   ( unsigned long us );
+
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
+
+#endif /* __INO_PCD8544_HOST_Arduino_h__ */
@@ -0,0 +1,334 @@
+/*
+ * PCD8544_Emulator.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "PCD8544_Emulator.h"
+
+// ---------------------------------------------------------------------------
+// PCD8544 command set
+// ---------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint8_t PD_BIT = 0b100;
+constexpr uint8_t V_BIT  = 0b010;
+constexpr uint8_t H_BIT  = 0b001;
+
+}
+
+// ---------------------------------------------------------------------------
+// PCD8544_Emulator
+// ---------------------------------------------------------------------------
+
+PCD8544_Emulator::PCD8544_Emulator ( const uint8_t sclkPin
+                                   , const uint8_t dataPin
+                                   , const uint8_t modePin
+                                   , const uint8_t cselPin
+                                   , const uint8_t resetPin )
+    : _sclkPin(sclkPin)
+    , _dataPin(dataPin)
+    , _modePin(modePin)
+    , _cselPin(cselPin)
+    , _resetPin(resetPin)
+    , _shift(0)
+    , _bits(0)
+    , _din(host::getPinLevel(dataPin))
+    , _function(0)
+    , _display(0)
+    , _voltOper(0)
+    , _biasSyst(0)
+    , _tempCtrl(0)
+    , _row(0)
+    , _col(0)
+    , _ram()
+    , _counters()
+{
+    reset();
+    host::attach(this);
+}
+
+PCD8544_Emulator::~PCD8544_Emulator()
+{
+    host::detach(this);
+}
+
+void PCD8544_Emulator::pinChanged(uint8_t pin, uint8_t level)
+{
+    if(pin == _resetPin) {
+        ++_counters.rst_edges;
+        if(level == LOW) {
+            reset();
+            ++_counters.resets;
+        }
+    }
+    if(pin == _cselPin) {
+        ++_counters.ce_edges;
+        /* a byte interrupted by CE going high is discarded */
+        if((level != LOW) && (_bits != 0)) {
+            ++_counters.aborted_bytes;
+            _shift = 0;
+            _bits  = 0;
+        }
+    }
+    if(pin == _modePin) {
+        ++_counters.dc_edges;
+    }
+    if(pin == _dataPin) {
+        ++_counters.din_edges;
+        _din = level;
+    }
+    if(pin == _sclkPin) {
+        ++_counters.sclk_edges;
+        /* DIN is sampled on the rising edge of SCLK while CE is low */
+        if((level != LOW) && (host::getPinLevel(_cselPin) == LOW)
+                          && (host::getPinLevel(_resetPin) != LOW)) {
+            _shift = static_cast<uint8_t>((_shift << 1) | (_din != LOW ? 1 : 0));
+            if(++_bits == 8) {
+                receive(_shift);
+                _shift = 0;
+                _bits  = 0;
+            }
+        }
+    }
+}
+
+void PCD8544_Emulator::spiTransfer(uint8_t value)
+{
+    if((host::getPinLevel(_cselPin) != LOW) || (host::getPinLevel(_resetPin) == LOW)) {
+        return;
+    }
+    /* account for the edges the hardware would have produced on the bus */ {
+        uint8_t din = _din;
+        for(uint8_t bit = 0; bit < 8; ++bit) {
+            const uint8_t level = ((value >> (7 - bit)) & 1);
+            if(level != din) {
+                ++_counters.din_edges;
+                din = level;
+            }
+        }
+        _din = din;
+        _counters.sclk_edges += 16;
+    }
+    receive(value);
+}
+
+void PCD8544_Emulator::reset()
+{
+    /* datasheet reset state: power-down, horizontal, basic instructions, blank */ {
+        _shift    = 0;
+        _bits     = 0;
+        _function = PD_BIT;
+        _display  = BLANK_MODE;
+        _voltOper = 0;
+        _biasSyst = 0;
+        _tempCtrl = 0;
+        _row      = 0;
+        _col      = 0;
+    }
+    ::memset(_ram, 0, sizeof(_ram));
+}
+
+uint8_t PCD8544_Emulator::getByte(const uint8_t row, const uint8_t col) const
+{
+    if((row >= MAX_ROWS) || (col >= MAX_COLS)) {
+        return 0;
+    }
+    return _ram[(row * MAX_COLS) + col];
+}
+
+bool PCD8544_Emulator::getPixel(const uint8_t x, const uint8_t y) const
+{
+    return ((getByte((y / 8), x) >> (y % 8)) & 1) != 0;
+}
+
+const uint8_t* PCD8544_Emulator::getRam() const
+{
+    return _ram;
+}
+
+bool PCD8544_Emulator::isPowerDown() const
+{
+    return (_function & PD_BIT) != 0;
+}
+
+bool PCD8544_Emulator::isVertical() const
+{
+    return (_function & V_BIT) != 0;
+}
+
+bool PCD8544_Emulator::isExtended() const
+{
+    return (_function & H_BIT) != 0;
+}
+
+uint8_t PCD8544_Emulator::getDisplayMode() const
+{
+    return _display;
+}
+
+uint8_t PCD8544_Emulator::getVoltOper() const
+{
+    return _voltOper;
+}
+
+uint8_t PCD8544_Emulator::getBiasSyst() const
+{
+    return _biasSyst;
+}
+
+uint8_t PCD8544_Emulator::getTempCtrl() const
+{
+    return _tempCtrl;
+}
+
+uint8_t PCD8544_Emulator::getRow() const
+{
+    return _row;
+}
+
+uint8_t PCD8544_Emulator::getCol() const
+{
+    return _col;
+}
+
+auto PCD8544_Emulator::getCounters() const -> const Counters&
+{
+    return _counters;
+}
+
+void PCD8544_Emulator::resetCounters()
+{
+    _counters = Counters();
+}
+
+void PCD8544_Emulator::dump(FILE* stream) const
+{
+    const bool powered = !isPowerDown();
+
+    ::fputc('+', stream);
+    for(uint8_t x = 0; x < MAX_COLS; ++x) {
+        ::fputc('-', stream);
+    }
+    ::fputs("+\n", stream);
+    for(uint8_t y = 0; y < (MAX_ROWS * 8); ++y) {
+        ::fputc('|', stream);
+        for(uint8_t x = 0; x < MAX_COLS; ++x) {
+            bool pixel = false;
+            if(powered) {
+                switch(_display) {
+                    case BLACK_MODE:
+                        pixel = true;
+                        break;
+                    case NORMAL_MODE:
+                        pixel = getPixel(x, y);
+                        break;
+                    case INVERSE_MODE:
+                        pixel = !getPixel(x, y);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            ::fputc((pixel ? '#' : ' '), stream);
+        }
+        ::fputs("|\n", stream);
+    }
+    ::fputc('+', stream);
+    for(uint8_t x = 0; x < MAX_COLS; ++x) {
+        ::fputc('-', stream);
+    }
+    ::fputs("+\n", stream);
+}
+
+void PCD8544_Emulator::receive(const uint8_t value)
+{
+    /* D/C is sampled with the eighth bit */
+    if(host::getPinLevel(_modePin) != LOW) {
+        data(value);
+    }
+    else {
+        command(value);
+    }
+}
+
+void PCD8544_Emulator::command(const uint8_t value)
+{
+    ++_counters.commands;
+    /* function set is common to both instruction sets */
+    if((value & 0b11111000) == 0b00100000) {
+        ++_counters.function_sets;
+        _function = (value & 0b00000111);
+        return;
+    }
+    if((_function & H_BIT) == 0) {
+        if((value & 0b10000000) != 0) {
+            ++_counters.address_commands;
+            _col = (value & 0b01111111);
+            if(_col >= MAX_COLS) {
+                _col = 0;
+            }
+        }
+        else if((value & 0b11111000) == 0b01000000) {
+            ++_counters.address_commands;
+            _row = (value & 0b00000111);
+            if(_row >= MAX_ROWS) {
+                _row = 0;
+            }
+        }
+        else if((value & 0b11111010) == 0b00001000) {
+            _display = (((value & 0b100) != 0 ? 0b100 : 0) | (value & 0b001));
+        }
+    }
+    else {
+        if((value & 0b10000000) != 0) {
+            _voltOper = (value & 0b01111111);
+        }
+        else if((value & 0b11111000) == 0b00010000) {
+            _biasSyst = (value & 0b00000111);
+        }
+        else if((value & 0b11111100) == 0b00000100) {
+            _tempCtrl = (value & 0b00000011);
+        }
+    }
+}
+
+void PCD8544_Emulator::data(const uint8_t value)
+{
+    ++_counters.data_bytes;
+    _ram[(_row * MAX_COLS) + _col] = value;
+    /* auto-increment according to the addressing mode */
+    if((_function & V_BIT) != 0) {
+        if(++_row >= MAX_ROWS) {
+            _row = 0;
+            if(++_col >= MAX_COLS) {
+                _col = 0;
+            }
+        }
+    }
+    else {
+        if(++_col >= MAX_COLS) {
+            _col = 0;
+            if(++_row >= MAX_ROWS) {
+                _row = 0;
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
@@ -0,0 +1,123 @@
+/*
+ * PCD8544_Emulator.h - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INO_PCD8544_HOST_PCD8544_Emulator_h__
+#define __INO_PCD8544_HOST_PCD8544_Emulator_h__
+
+#include <stdio.h>
+#include "Arduino.h"
+
+// ---------------------------------------------------------------------------
+// PCD8544_Emulator
+// ---------------------------------------------------------------------------
+
+/*
+ * Software model of the controller. It watches the pins of the host board
+ * (or the bytes of the SPI stand-in while CE is low), decodes the serial
+ * protocol and the command set into a virtual 84x48 display RAM, and
+ * counts every pin edge, command and data byte.
+ */
+
+class PCD8544_Emulator
+    : public host::PinObserver
+{
+public: // public interface
+    static constexpr uint8_t MAX_ROWS   = (48 / 8);
+    static constexpr uint8_t MAX_COLS   = (84 / 1);
+    static constexpr uint16_t BYTE_COUNT = (MAX_ROWS * MAX_COLS);
+
+    static constexpr uint8_t BLANK_MODE   = 0b000;
+    static constexpr uint8_t BLACK_MODE   = 0b001;
+    static constexpr uint8_t NORMAL_MODE  = 0b100;
+    static constexpr uint8_t INVERSE_MODE = 0b101;
+
+    struct Counters
+    {
+        uint32_t commands;
+        uint32_t data_bytes;
+        uint32_t address_commands;
+        uint32_t function_sets;
+        uint32_t sclk_edges;
+        uint32_t din_edges;
+        uint32_t dc_edges;
+        uint32_t ce_edges;
+        uint32_t rst_edges;
+        uint32_t resets;
+        uint32_t aborted_bytes;
+    };
+
+    PCD8544_Emulator ( const uint8_t sclkPin
+                     , const uint8_t dataPin
+                     , const uint8_t modePin
+                     , const uint8_t cselPin
+                     , const uint8_t resetPin );
+
+    virtual ~PCD8544_Emulator();
+
+    virtual void pinChanged  ( uint8_t pin, uint8_t level ) override;
+
+    virtual void spiTransfer ( uint8_t value ) override;
+
+    void reset();
+
+    uint8_t         getByte        ( const uint8_t row, const uint8_t col ) const;
+    bool            getPixel       ( const uint8_t x, const uint8_t y ) const;
+    const uint8_t*  getRam         ( ) const;
+    bool            isPowerDown    ( ) const;
+    bool            isVertical     ( ) const;
+    bool            isExtended     ( ) const;
+    uint8_t         getDisplayMode ( ) const;
+    uint8_t         getVoltOper    ( ) const;
+    uint8_t         getBiasSyst    ( ) const;
+    uint8_t         getTempCtrl    ( ) const;
+    uint8_t         getRow         ( ) const;
+    uint8_t         getCol         ( ) const;
+    const Counters& getCounters    ( ) const;
+    void            resetCounters  ( );
+    void            dump           ( FILE* stream ) const;
+
+protected: // protected interface
+    void receive ( const uint8_t value );
+    void command ( const uint8_t value );
+    void data    ( const uint8_t value );
+
+protected: // protected data
+    uint8_t const _sclkPin;
+    uint8_t const _dataPin;
+    uint8_t const _modePin;
+    uint8_t const _cselPin;
+    uint8_t const _resetPin;
+    uint8_t       _shift;
+    uint8_t       _bits;
+    uint8_t       _din;
+    uint8_t       _function;
+    uint8_t       _display;
+    uint8_t       _voltOper;
+    uint8_t       _biasSyst;
+    uint8_t       _tempCtrl;
+    uint8_t       _row;
+    uint8_t       _col;
+    uint8_t       _ram[BYTE_COUNT];
+    Counters      _counters;
+};
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
+
+#endif /* __INO_PCD8544_HOST_PCD8544_Emulator_h__ */
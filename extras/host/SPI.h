@@ -0,0 +1,93 @@
+/*
+ * SPI.h - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INO_PCD8544_HOST_SPI_h__
+#define __INO_PCD8544_HOST_SPI_h__
+
+#include "Arduino.h"
+
+/*
+ * Host stand-in for the SPI library, every transferred byte is forwarded
+ * to the attached observers as if it was clocked on SCK/MOSI.
+ */
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+// ---------------------------------------------------------------------------
+// SPISettings
+// ---------------------------------------------------------------------------
+
+class SPISettings
+{
+public: // public interface
+    SPISettings ( uint32_t clock = 4000000UL
+                , uint8_t  bitOrder = MSBFIRST
+                , uint8_t  dataMode = SPI_MODE0 )
+        : _clock(clock)
+        , _bitOrder(bitOrder)
+        , _dataMode(dataMode)
+    {
+    }
+
+    uint32_t _clock;
+    uint8_t  _bitOrder;
+    uint8_t  _dataMode;
+};
+
+// ---------------------------------------------------------------------------
+// SPIClass
+// ---------------------------------------------------------------------------
+
+class SPIClass
+{
+public: // public interface
+    static void begin()
+    {
+    }
+
+    static void end()
+    {
+    }
+
+    static void beginTransaction(const SPISettings& settings)
+    {
+        static_cast<void>(settings);
+    }
+
+    static void endTransaction()
+    {
+    }
+
+    static uint8_t transfer(const uint8_t value)
+    {
+        host::notifySpi(value);
+
+        return 0x00;
+    }
+};
+
+extern SPIClass SPI;
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
+
+#endif /* __INO_PCD8544_HOST_SPI_h__ */
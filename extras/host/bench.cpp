@@ -0,0 +1,431 @@
+/*
+ * bench.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Arduino.h"
+#include "PCD8544.h"
+#include "PCD8544_Field.h"
+#include "PCD8544_Emulator.h"
+#include "Shield.h"
+
+// ---------------------------------------------------------------------------
+// Bench_Traits
+// ---------------------------------------------------------------------------
+
+/*
+ * Rough AVR cost model used to turn the host counters into cycles. The
+ * digitalWrite() figure includes the pin lookup done by the Arduino core,
+ * shiftOut() adds its loop overhead on top of its 16 pin writes, and an SPI
+ * byte costs 8 bit times at the SPI clock plus the load/poll overhead.
+ */
+
+struct Bench_Traits
+{
+    struct Wiring
+    {
+        static constexpr uint8_t SCLK_PIN  = 2;
+        static constexpr uint8_t DATA_PIN  = 3;
+        static constexpr uint8_t MODE_PIN  = 4;
+        static constexpr uint8_t CSEL_PIN  = 5;
+        static constexpr uint8_t RESET_PIN = 6;
+        static constexpr uint8_t LIGHT_PIN = 7;
+        static constexpr uint8_t CSEL2_PIN = 8;
+    };
+
+    struct Cycles
+    {
+        static constexpr uint32_t DIGITAL_WRITE = 56;
+        static constexpr uint32_t SHIFT_OUT     = 48;
+        static constexpr uint32_t SPI_OVERHEAD  = 12;
+    };
+
+    struct Default
+    {
+        static constexpr uint32_t CPU_CLOCK = 16000000UL;
+        static constexpr uint32_t SPI_CLOCK =  4000000UL;
+    };
+};
+
+// ---------------------------------------------------------------------------
+// Bench_Options
+// ---------------------------------------------------------------------------
+
+struct Bench_Options
+{
+    uint32_t    cpu_clock;
+    uint32_t    spi_clock;
+    const char* transport;
+};
+
+// ---------------------------------------------------------------------------
+// workloads
+// ---------------------------------------------------------------------------
+
+namespace {
+
+const uint8_t image_pgm[PCD8544_Traits::Screen::BYTE_COUNT] PROGMEM = {
+#define ROW(v) v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, \
+               v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, \
+               v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, \
+               v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v
+    ROW(0x55), ROW(0xaa), ROW(0x0f), ROW(0xf0), ROW(0x33), ROW(0xcc)
+#undef ROW
+};
+
+void benchClearDisplay(PCD8544& screen)
+{
+    screen.clearDisplay(0x00);
+}
+
+void benchPutImagePgm(PCD8544& screen)
+{
+    screen.putImage(image_pgm, true);
+}
+
+void benchPutImageRam(PCD8544& screen)
+{
+    uint8_t image[PCD8544_Traits::Screen::BYTE_COUNT];
+
+    ::memcpy(image, image_pgm, sizeof(image));
+    screen.putImage(image, false);
+}
+
+void benchWrite84(PCD8544& screen)
+{
+    screen.setCursor(0, 0);
+    for(uint8_t index = 0; index < 84; ++index) {
+        screen.write(static_cast<uint8_t>('!' + (index % 94)));
+    }
+}
+
+void benchPrint84(PCD8544& screen)
+{
+    uint8_t chars[84];
+
+    for(uint8_t index = 0; index < 84; ++index) {
+        chars[index] = static_cast<uint8_t>('!' + (index % 94));
+    }
+    screen.setCursor(0, 0);
+    screen.write(chars, sizeof(chars));
+}
+
+void benchScaledDigits(PCD8544& screen)
+{
+    screen.setTextScale(3);
+    screen.setCursor(0, 0);
+    screen.print(F("12:34"));
+}
+
+void benchGauge(PCD8544& screen)
+{
+    static uint8_t frame[PCD8544_Traits::Screen::BYTE_COUNT];
+
+    screen.setFrameBuffer(frame);
+    screen.clearDisplay(0x00);
+    screen.drawRect(0, 0, 84, 48, PCD8544_Traits::Color::BLACK);
+    screen.drawCircle(42, 30, 14, PCD8544_Traits::Color::BLACK);
+    screen.drawLine(42, 30, 52, 20, PCD8544_Traits::Color::BLACK);
+    screen.fillRect(4, 4, 60, 6, PCD8544_Traits::Color::BLACK);
+    screen.flush();
+    screen.setFrameBuffer(nullptr);
+}
+
+void prepareFrame(PCD8544& screen)
+{
+    static uint8_t frame[PCD8544_Traits::Screen::BYTE_COUNT];
+    static uint8_t shadow[PCD8544_Traits::Screen::BYTE_COUNT];
+
+    screen.setFrameBuffer(frame);
+    screen.setShadowBuffer(shadow);
+    screen.clearDisplay(0x00);
+    screen.flush();
+}
+
+void benchIconBlit(PCD8544& screen)
+{
+    static const uint8_t icon[32] PROGMEM = {
+        0xe0, 0x18, 0x04, 0x02, 0x02, 0x01, 0x01, 0xff, 0xff, 0x01, 0x01, 0x02, 0x02, 0x04, 0x18, 0xe0,
+        0x07, 0x18, 0x20, 0x40, 0x40, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0x40, 0x40, 0x20, 0x18, 0x07
+    };
+
+    screen.drawBitmap(30, 13, 16, 16, icon, true, PCD8544_Traits::Blit::XOR);
+    screen.flush();
+}
+
+void benchIconRegion(PCD8544& screen)
+{
+    static const uint8_t icon[48] PROGMEM = {
+        0xfc, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff,
+        0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0xfc,
+        0x3f, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff,
+        0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x3f
+    };
+
+    screen.putImage(2, 30, 24, 2, icon, true);
+}
+
+const uint8_t packed_key[52] PROGMEM = {
+    0x00, 0xff, 0x7f, 0x01, 0x51, 0x01, 0x01, 0xff, 0xff, 0x7f, 0x00, 0x51,
+    0x00, 0x01, 0xff, 0xff, 0x52, 0x00, 0x01, 0x3c, 0x7e, 0x43, 0xff, 0x01,
+    0x7e, 0x3c, 0x76, 0x00, 0x01, 0xff, 0xff, 0x7f, 0x00, 0x51, 0x00, 0x01,
+    0xff, 0xff, 0x7f, 0x00, 0x51, 0x00, 0x01, 0xff, 0xff, 0x7f, 0x80, 0x51,
+    0x80, 0x00, 0xff, 0xc0
+};
+
+const uint8_t packed_delta[14] PROGMEM = {
+    0xbf, 0xbf, 0xbb, 0x43, 0x00, 0x01, 0x3c, 0x7e, 0x43, 0xff, 0x01, 0x7e,
+    0x3c, 0xc0
+};
+
+void benchPackedKey(PCD8544& screen)
+{
+    screen.putPackedImage(packed_key, true);
+}
+
+void benchPackedDelta(PCD8544& screen)
+{
+    screen.putPackedImage(packed_delta, true);
+}
+
+void prepareCounter(PCD8544_Field& field)
+{
+    field.setFont(PCD8544_Digits10x16);
+    field.setValue(41999L);
+}
+
+void benchCounter(PCD8544_Field& field)
+{
+    field.setValue(42000L);
+}
+
+void benchCursorPrint(PCD8544& screen)
+{
+    screen.setCursor(0, 0);
+    for(uint8_t line = 0; line < 6; ++line) {
+        screen.print(F("line "));
+        screen.print(line);
+        screen.print(F("\rLINE"));
+        screen.println();
+    }
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// Bench
+// ---------------------------------------------------------------------------
+
+class Bench
+{
+public: // public interface
+    Bench(const Bench_Options& options)
+        : _options(options)
+        , _emulator ( Wiring::SCLK_PIN
+                    , Wiring::DATA_PIN
+                    , Wiring::MODE_PIN
+                    , Wiring::CSEL_PIN
+                    , Wiring::RESET_PIN )
+        , _softTransport ( Wiring::SCLK_PIN
+                         , Wiring::DATA_PIN
+                         , Wiring::MODE_PIN
+                         , Wiring::CSEL_PIN )
+        , _spiTransport ( Wiring::MODE_PIN
+                        , Wiring::CSEL_PIN
+                        , options.spi_clock )
+    {
+    }
+
+    void run(const char* name, void (*workload)(PCD8544&), void (*prepare)(PCD8544&) = nullptr)
+    {
+        PCD8544 screen(getTransport(), Wiring::RESET_PIN, Wiring::LIGHT_PIN);
+
+        screen.begin();
+        if(prepare != nullptr) {
+            (*prepare)(screen);
+        }
+        start();
+        (*workload)(screen);
+        stop(name, _options.transport);
+        screen.end();
+    }
+
+    void runField(const char* name, void (*workload)(PCD8544_Field&), void (*prepare)(PCD8544_Field&))
+    {
+        PCD8544       screen(getTransport(), Wiring::RESET_PIN, Wiring::LIGHT_PIN);
+        PCD8544_Field field(screen, 2, 2, 8);
+
+        screen.begin();
+        (*prepare)(field);
+        start();
+        (*workload)(field);
+        stop(name, _options.transport);
+        screen.end();
+    }
+
+    void runMirrored(const char* name, void (*workload)(PCD8544&))
+    {
+        PCD8544_Emulator       mirror ( Wiring::SCLK_PIN
+                                      , Wiring::DATA_PIN
+                                      , Wiring::MODE_PIN
+                                      , Wiring::CSEL2_PIN
+                                      , Wiring::RESET_PIN );
+        PCD8544_SoftTransport  wire ( Wiring::SCLK_PIN
+                                    , Wiring::DATA_PIN
+                                    , Wiring::MODE_PIN
+                                    , PCD8544_Transport::NO_PIN );
+        PCD8544_SharedBus      bus(wire, Wiring::CSEL_PIN, Wiring::CSEL2_PIN);
+        PCD8544_PanelTransport both(bus, 0x03);
+        PCD8544                screen(both, Wiring::RESET_PIN, Wiring::LIGHT_PIN);
+
+        screen.begin();
+        start();
+        (*workload)(screen);
+        stop(name, "soft");
+        screen.end();
+    }
+
+    void runShield()
+    {
+        Shield shield;
+
+        shield.setup();
+        shield.loop();
+        start();
+        shield.loop();
+        stop("shield_loop", "soft");
+    }
+
+protected: // protected interface
+    using Traits = Bench_Traits;
+    using Wiring = Traits::Wiring;
+    using Cycles = Traits::Cycles;
+
+    PCD8544_Transport& getTransport()
+    {
+        if(::strcmp(_options.transport, "spi") == 0) {
+            return _spiTransport;
+        }
+        return _softTransport;
+    }
+
+    void start()
+    {
+        host::resetCounters();
+        _emulator.resetCounters();
+    }
+
+    void stop(const char* name, const char* transport)
+    {
+        const host::Counters&             board(host::getCounters());
+        const PCD8544_Emulator::Counters& lcd(_emulator.getCounters());
+        const uint32_t spi_byte = ((8UL * _options.cpu_clock) / _options.spi_clock) + Cycles::SPI_OVERHEAD;
+        const uint64_t cycles   = (static_cast<uint64_t>(board.digital_writes) * Cycles::DIGITAL_WRITE)
+                                + (static_cast<uint64_t>(board.shift_outs)     * Cycles::SHIFT_OUT)
+                                + (static_cast<uint64_t>(board.spi_transfers)  * spi_byte);
+        const uint64_t micros   = ((cycles * 1000000ULL) / _options.cpu_clock);
+
+        ::fprintf(stdout, "{\"workload\":\"%s\",\"transport\":\"%s\",\"bytes\":%lu,\"commands\":%lu"
+                          ",\"address_commands\":%lu,\"ce_toggles\":%lu,\"dc_toggles\":%lu"
+                          ",\"sclk_edges\":%lu,\"din_edges\":%lu,\"digital_writes\":%lu"
+                          ",\"spi_transfers\":%lu,\"cpu_clock\":%lu,\"cycles\":%llu,\"us\":%llu}\n"
+                        , name
+                        , transport
+                        , static_cast<unsigned long>(lcd.data_bytes)
+                        , static_cast<unsigned long>(lcd.commands)
+                        , static_cast<unsigned long>(lcd.address_commands)
+                        , static_cast<unsigned long>(lcd.ce_edges)
+                        , static_cast<unsigned long>(lcd.dc_edges)
+                        , static_cast<unsigned long>(lcd.sclk_edges)
+                        , static_cast<unsigned long>(lcd.din_edges)
+                        , static_cast<unsigned long>(board.digital_writes)
+                        , static_cast<unsigned long>(board.spi_transfers)
+                        , static_cast<unsigned long>(_options.cpu_clock)
+                        , static_cast<unsigned long long>(cycles)
+                        , static_cast<unsigned long long>(micros));
+    }
+
+protected: // protected data
+    Bench_Options const   _options;
+    PCD8544_Emulator      _emulator;
+    PCD8544_SoftTransport _softTransport;
+    PCD8544_SpiTransport  _spiTransport;
+};
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    Bench_Options options = {
+        Bench_Traits::Default::CPU_CLOCK,
+        Bench_Traits::Default::SPI_CLOCK,
+        "soft"
+    };
+
+    /* parse the command-line */ {
+        for(int argi = 1; argi < argc; ++argi) {
+            const char* arg = argv[argi];
+            if(::strncmp(arg, "--clock=", 8) == 0) {
+                options.cpu_clock = ::strtoul(arg + 8, nullptr, 0);
+            }
+            else if(::strncmp(arg, "--spi-clock=", 12) == 0) {
+                options.spi_clock = ::strtoul(arg + 12, nullptr, 0);
+            }
+            else if(::strcmp(arg, "--transport=soft") == 0) {
+                options.transport = "soft";
+            }
+            else if(::strcmp(arg, "--transport=spi") == 0) {
+                options.transport = "spi";
+            }
+            else {
+                ::fprintf(stderr, "usage: %s [--clock=HZ] [--spi-clock=HZ] [--transport=soft|spi]\n", argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        if((options.cpu_clock == 0) || (options.spi_clock == 0)) {
+            ::fprintf(stderr, "%s: invalid clock\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    /* run the workloads */ {
+        Bench bench(options);
+        bench.run("clear_display", &benchClearDisplay);
+        bench.run("put_image_pgm", &benchPutImagePgm);
+        bench.run("put_image_ram", &benchPutImageRam);
+        bench.run("write_84_chars", &benchWrite84);
+        bench.run("print_84_chars", &benchPrint84);
+        bench.run("cursor_print", &benchCursorPrint);
+        bench.run("scaled_digits", &benchScaledDigits);
+        bench.run("gauge", &benchGauge);
+        bench.run("icon_blit", &benchIconBlit, &prepareFrame);
+        bench.run("icon_region", &benchIconRegion);
+        bench.run("packed_key", &benchPackedKey);
+        bench.run("packed_delta", &benchPackedDelta, &benchPackedKey);
+        bench.runField("field_counter", &benchCounter, &prepareCounter);
+        bench.runMirrored("mirrored_image", &benchPutImagePgm);
+        bench.runShield();
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
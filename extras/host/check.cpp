@@ -0,0 +1,339 @@
+/*
+ * check.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Arduino.h"
+#include "PCD8544.h"
+#include "PCD8544_Field.h"
+#include "PCD8544_Emulator.h"
+
+// ---------------------------------------------------------------------------
+// Check_Traits
+// ---------------------------------------------------------------------------
+
+/*
+ * Regression checks of the rendered glass. Each check drives the display
+ * under test, wired to the first emulator, and compares the display RAM
+ * with the expected bytes or with a reference display wired to a second
+ * emulator and driven through the plain, unoptimized paths.
+ */
+
+struct Check_Traits
+{
+    struct Wiring
+    {
+        static constexpr uint8_t SCLK_PIN  = 2;
+        static constexpr uint8_t DATA_PIN  = 3;
+        static constexpr uint8_t MODE_PIN  = 4;
+        static constexpr uint8_t CSEL_PIN  = 5;
+        static constexpr uint8_t RESET_PIN = 6;
+        static constexpr uint8_t LIGHT_PIN = 7;
+    };
+
+    struct Reference
+    {
+        static constexpr uint8_t SCLK_PIN  = 12;
+        static constexpr uint8_t DATA_PIN  = 13;
+        static constexpr uint8_t MODE_PIN  = 14;
+        static constexpr uint8_t CSEL_PIN  = 15;
+        static constexpr uint8_t RESET_PIN = 16;
+        static constexpr uint8_t LIGHT_PIN = 17;
+    };
+};
+
+// ---------------------------------------------------------------------------
+// Check
+// ---------------------------------------------------------------------------
+
+class Check
+{
+public: // public interface
+    Check()
+        : _emulator ( Wiring::SCLK_PIN
+                    , Wiring::DATA_PIN
+                    , Wiring::MODE_PIN
+                    , Wiring::CSEL_PIN
+                    , Wiring::RESET_PIN )
+        , _reference ( Reference::SCLK_PIN
+                     , Reference::DATA_PIN
+                     , Reference::MODE_PIN
+                     , Reference::CSEL_PIN
+                     , Reference::RESET_PIN )
+        , _failures(0)
+    {
+    }
+
+    void run(const char* name, bool (*check)(Check&))
+    {
+        const bool passed = (*check)(*this);
+
+        ::fprintf(stdout, "%s %s\n", (passed ? "ok  " : "FAIL"), name);
+        if(passed == false) {
+            ++_failures;
+        }
+    }
+
+    PCD8544_Emulator& getEmulator()
+    {
+        return _emulator;
+    }
+
+    bool matchReference() const
+    {
+        return ::memcmp(_emulator.getRam(), _reference.getRam(), PCD8544_Emulator::BYTE_COUNT) == 0;
+    }
+
+    int getFailures() const
+    {
+        return _failures;
+    }
+
+protected: // protected interface
+    using Traits    = Check_Traits;
+    using Wiring    = Traits::Wiring;
+    using Reference = Traits::Reference;
+
+protected: // protected data
+    PCD8544_Emulator _emulator;
+    PCD8544_Emulator _reference;
+    int              _failures;
+};
+
+// ---------------------------------------------------------------------------
+// displays
+// ---------------------------------------------------------------------------
+
+namespace {
+
+class Display
+    : public PCD8544
+{
+public: // public interface
+    Display()
+        : PCD8544 ( Check_Traits::Wiring::SCLK_PIN
+                  , Check_Traits::Wiring::DATA_PIN
+                  , Check_Traits::Wiring::MODE_PIN
+                  , Check_Traits::Wiring::CSEL_PIN
+                  , Check_Traits::Wiring::RESET_PIN
+                  , Check_Traits::Wiring::LIGHT_PIN )
+    {
+        begin();
+    }
+};
+
+class ReferenceDisplay
+    : public PCD8544
+{
+public: // public interface
+    ReferenceDisplay()
+        : PCD8544 ( Check_Traits::Reference::SCLK_PIN
+                  , Check_Traits::Reference::DATA_PIN
+                  , Check_Traits::Reference::MODE_PIN
+                  , Check_Traits::Reference::CSEL_PIN
+                  , Check_Traits::Reference::RESET_PIN
+                  , Check_Traits::Reference::LIGHT_PIN )
+    {
+        begin();
+    }
+};
+
+}
+
+// ---------------------------------------------------------------------------
+// checks
+// ---------------------------------------------------------------------------
+
+namespace {
+
+bool checkWideImage(Check& check, const bool frame)
+{
+    static uint8_t buffer[PCD8544_Traits::Screen::BYTE_COUNT];
+    uint8_t        image[2 * 100];
+    Display        screen;
+
+    for(uint16_t index = 0; index < sizeof(image); ++index) {
+        image[index] = static_cast<uint8_t>(index + 1);
+    }
+    if(frame != false) {
+        screen.setFrameBuffer(buffer);
+        screen.clearDisplay(0x00);
+    }
+    /* a 100 columns source is clipped to the screen but keeps its stride */ {
+        screen.putImage(1, 0, 100, 2, image, false);
+        screen.flush();
+    }
+    for(uint8_t bank = 0; bank < 2; ++bank) {
+        for(uint8_t col = 0; col < PCD8544_Traits::Screen::MAX_COLS; ++col) {
+            if(check.getEmulator().getByte((1 + bank), col) != image[(bank * 100) + col]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool checkWideImageDirect(Check& check)
+{
+    return checkWideImage(check, false);
+}
+
+bool checkWideImageFrame(Check& check)
+{
+    return checkWideImage(check, true);
+}
+
+
+bool checkScaledCells(Check& check)
+{
+    static const char text[] = "ab\ncd\r\n0123456789abcd\r\nef\033[5;3Hgh\nij";
+    uint8_t           cells[PCD8544_Traits::Cells::CELL_COUNT];
+    Display           screen;
+    ReferenceDisplay  reference;
+
+    /* a line feed moves down one cell row, whatever the scale */ {
+        screen.setCellBuffer(cells);
+        screen.setTextScale(2);
+        screen.clearDisplay(0x00);
+        screen.print(text);
+        screen.refresh();
+    }
+    /* the cells are rendered at scale 1 */ {
+        reference.print(text);
+    }
+    return check.matchReference();
+}
+
+bool checkFilledCells(Check& check)
+{
+    uint8_t cells[PCD8544_Traits::Cells::CELL_COUNT];
+    Display screen;
+
+    /* a black fill is kept as reverse video blank cells */ {
+        screen.setCellBuffer(cells);
+        screen.clearDisplay(0xff);
+        check.getEmulator().resetCounters();
+        screen.refresh();
+    }
+    if(check.getEmulator().getCounters().data_bytes != 0) {
+        return false;
+    }
+    for(uint16_t index = 0; index < PCD8544_Emulator::BYTE_COUNT; ++index) {
+        if(check.getEmulator().getRam()[index] != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool checkFieldAtRightEdge(Check& check)
+{
+    static const PCD8544_Font* const fonts[] = {
+        &PCD8544_Font6x8,
+        &PCD8544_Font4x6,
+        &PCD8544_Digits10x16,
+    };
+    static const long values[] = {
+        0, 7, 8, 15, 16, -3, 99, 100, 41999, 42000, -12345, 9999999,
+    };
+    Display          screen;
+    ReferenceDisplay reference;
+
+    /* incremental updates must match a full redraw, even when clipped */
+    for(uint8_t font = 0; font < (sizeof(fonts) / sizeof(fonts[0])); ++font) {
+        for(uint8_t scale = 1; scale <= 2; ++scale) {
+            for(uint8_t col = 40; col < PCD8544_Traits::Screen::MAX_COLS; col += 3) {
+                for(uint8_t width = 1; width <= PCD8544_Traits::Field::MAX_WIDTH; width += 3) {
+                    PCD8544_Field field(screen, 1, col, width, (width % 3));
+                    PCD8544_Field other(reference, 1, col, width, (width % 3));
+                    screen.clearDisplay(0x00);
+                    reference.clearDisplay(0x00);
+                    field.setFont(*fonts[font], scale);
+                    other.setFont(*fonts[font], scale);
+                    for(uint8_t index = 0; index < (sizeof(values) / sizeof(values[0])); ++index) {
+                        field.setValue(values[index]);
+                        other.invalidate();
+                        other.setValue(values[index]);
+                        if(check.matchReference() == false) {
+                            return false;
+                        }
+                    }
+                    /* nothing is drawn on the next bank row, at column 0 */
+                    if(check.getEmulator().getByte(((1 + (fonts[font]->height * scale)) % PCD8544_Traits::Screen::MAX_ROWS), 0) != 0x00) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+
+bool checkFieldInConsole(Check& check)
+{
+    static uint8_t   buffer[PCD8544_Traits::Screen::BYTE_COUNT];
+    Display          screen;
+    ReferenceDisplay reference;
+    PCD8544_Field    field(screen, 5, 0, 6, 1);
+    PCD8544_Field    other(reference, 5, 0, 6, 1);
+
+    /* a field reaching past the last bank never scrolls the console */ {
+        screen.setFrameBuffer(buffer);
+        screen.setConsoleMode(true);
+        screen.clearDisplay(0x00);
+        screen.print("console");
+        reference.print("console");
+        field.setFont(PCD8544_Digits10x16);
+        other.setFont(PCD8544_Digits10x16);
+    }
+    for(long value = -20; value <= 20; value += 3) {
+        field.setValue(value);
+        other.setValue(value);
+        screen.flush();
+        if(check.matchReference() == false) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+int main()
+{
+    Check check;
+
+    check.run("wide_image_direct", &checkWideImageDirect);
+    check.run("wide_image_frame", &checkWideImageFrame);
+    check.run("scaled_cells", &checkScaledCells);
+    check.run("filled_cells", &checkFilledCells);
+    check.run("field_at_right_edge", &checkFieldAtRightEdge);
+    check.run("field_in_console", &checkFieldInConsole);
+
+    return (check.getFailures() == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
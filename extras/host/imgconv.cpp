@@ -0,0 +1,542 @@
+/*
+ * imgconv.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "PCD8544.h"
+
+/*
+ * Offline converter from PBM/PGM files (plain or raw) to C headers. Each
+ * image is thresholded or dithered to one bit per pixel, packed into the
+ * bank layout of the display RAM (one byte per column and bank, LSB at the
+ * top) and written as a PROGMEM array with its metadata. Full-screen images
+ * can also be written in the packed format of PCD8544::putPackedImage(),
+ * every image after the first one being a delta against the previous one.
+ */
+
+// ---------------------------------------------------------------------------
+// ImgConv_Traits
+// ---------------------------------------------------------------------------
+
+struct ImgConv_Traits
+{
+    struct Dither
+    {
+        static constexpr uint8_t NONE    = 0;
+        static constexpr uint8_t FLOYD   = 1;
+        static constexpr uint8_t ORDERED = 2;
+    };
+
+    struct Default
+    {
+        static constexpr int     THRESHOLD = 128;
+        static constexpr uint8_t DITHER    = Dither::NONE;
+    };
+
+    struct Packed
+    {
+        static constexpr int MIN_REPEAT = 3;
+    };
+
+    struct Output
+    {
+        static constexpr int BYTES_PER_LINE = 12;
+    };
+};
+
+// ---------------------------------------------------------------------------
+// ImgConv_Options
+// ---------------------------------------------------------------------------
+
+struct ImgConv_Options
+{
+    int                      threshold;
+    uint8_t                  dither;
+    bool                     invert;
+    bool                     packed;
+    std::string              name;
+    const char*              output;
+    std::vector<const char*> inputs;
+};
+
+// ---------------------------------------------------------------------------
+// ImgConv_Image
+// ---------------------------------------------------------------------------
+
+struct ImgConv_Image
+{
+    int                  width;
+    int                  height;
+    std::vector<float>   pixels; /* luminance, 0 is black and 1 is white */
+    std::vector<uint8_t> bits;   /* packed in the display RAM layout */
+};
+
+// ---------------------------------------------------------------------------
+// PNM reader
+// ---------------------------------------------------------------------------
+
+namespace {
+
+using Traits  = ImgConv_Traits;
+using Options = ImgConv_Options;
+using Image   = ImgConv_Image;
+
+bool skipSpaces(FILE* stream)
+{
+    int character = ::fgetc(stream);
+
+    while(character != EOF) {
+        if(character == '#') {
+            do {
+                character = ::fgetc(stream);
+            } while((character != EOF) && (character != '\n'));
+            continue;
+        }
+        if(::isspace(character) == 0) {
+            ::ungetc(character, stream);
+            return true;
+        }
+        character = ::fgetc(stream);
+    }
+    return false;
+}
+
+bool readNumber(FILE* stream, int& value)
+{
+    if(skipSpaces(stream) == false) {
+        return false;
+    }
+    return ::fscanf(stream, "%d", &value) == 1;
+}
+
+bool readBit(FILE* stream, int& value)
+{
+    /* plain PBM samples may be written without separators */
+    if(skipSpaces(stream) == false) {
+        return false;
+    }
+    const int character = ::fgetc(stream);
+    if((character != '0') && (character != '1')) {
+        return false;
+    }
+    value = (character - '0');
+    return true;
+}
+
+bool readImage(const char* filename, Image& image)
+{
+    FILE* stream = ::fopen(filename, "rb");
+    int   format = 0;
+    int   maxval = 1;
+
+    if(stream == nullptr) {
+        ::fprintf(stderr, "imgconv: %s: unable to open\n", filename);
+        return false;
+    }
+    /* read the header */ {
+        char magic[2];
+        if((::fread(magic, 1, 2, stream) != 2) || (magic[0] != 'P') || (::strchr("1245", magic[1]) == nullptr)) {
+            ::fprintf(stderr, "imgconv: %s: not a PBM/PGM file\n", filename);
+            ::fclose(stream);
+            return false;
+        }
+        format = (magic[1] - '0');
+        if((readNumber(stream, image.width) == false)
+        || (readNumber(stream, image.height) == false)
+        || (((format == 2) || (format == 5)) && (readNumber(stream, maxval) == false))
+        || (image.width <= 0) || (image.height <= 0) || (maxval <= 0) || (maxval > 65535)) {
+            ::fprintf(stderr, "imgconv: %s: invalid header\n", filename);
+            ::fclose(stream);
+            return false;
+        }
+        if((format == 4) || (format == 5)) {
+            /* a single whitespace separates the header from the raster */
+            ::fgetc(stream);
+        }
+    }
+    /* read the raster */ {
+        const int stride = ((image.width + 7) / 8);
+        std::vector<uint8_t> row(stride);
+        bool                 good = true;
+
+        image.pixels.assign((image.width * image.height), 1.0f);
+        for(int y = 0; (y < image.height) && (good != false); ++y) {
+            if((format == 4) && (::fread(row.data(), 1, stride, stream) != static_cast<size_t>(stride))) {
+                good = false;
+            }
+            for(int x = 0; (x < image.width) && (good != false); ++x) {
+                int value = 0;
+                switch(format) {
+                    case 1:
+                        good  = readBit(stream, value);
+                        value = (1 - value);
+                        break;
+                    case 2:
+                        good  = readNumber(stream, value);
+                        break;
+                    case 4:
+                        value = (((row[x / 8] >> (7 - (x % 8))) & 1) == 0 ? 1 : 0);
+                        break;
+                    case 5:
+                        value = ::fgetc(stream);
+                        if((value != EOF) && (maxval > 255)) {
+                            const int low = ::fgetc(stream);
+                            value = ((low != EOF) ? ((value << 8) | low) : EOF);
+                        }
+                        good = (value != EOF);
+                        break;
+                    default:
+                        break;
+                }
+                image.pixels[(y * image.width) + x] = (static_cast<float>(value) / static_cast<float>(maxval));
+            }
+        }
+        if(good == false) {
+            ::fprintf(stderr, "imgconv: %s: truncated raster\n", filename);
+            ::fclose(stream);
+            return false;
+        }
+    }
+    ::fclose(stream);
+    return true;
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// conversion
+// ---------------------------------------------------------------------------
+
+namespace {
+
+void convertImage(Image& image, const Options& options)
+{
+    static const uint8_t bayer[4][4] = {
+        {  0,  8,  2, 10 },
+        { 12,  4, 14,  6 },
+        {  3, 11,  1,  9 },
+        { 15,  7, 13,  5 }
+    };
+    const int   banks     = ((image.height + 7) / 8);
+    const float threshold = (static_cast<float>(options.threshold) / 256.0f);
+    std::vector<float> pixels(image.pixels);
+
+    if(options.invert != false) {
+        for(float& pixel : pixels) {
+            pixel = (1.0f - pixel);
+        }
+    }
+    image.bits.assign((banks * image.width), 0x00);
+    for(int y = 0; y < image.height; ++y) {
+        for(int x = 0; x < image.width; ++x) {
+            const float pixel = pixels[(y * image.width) + x];
+            float       limit = threshold;
+            if(options.dither == Traits::Dither::ORDERED) {
+                limit = ((static_cast<float>(bayer[y % 4][x % 4]) + 0.5f) / 16.0f);
+            }
+            const bool  black = (pixel < limit);
+            if(black != false) {
+                image.bits[((y / 8) * image.width) + x] |= (1 << (y % 8));
+            }
+            if(options.dither == Traits::Dither::FLOYD) {
+                const float error = (pixel - (black != false ? 0.0f : 1.0f));
+                if((x + 1) < image.width) {
+                    pixels[(y * image.width) + (x + 1)] += (error * 7.0f / 16.0f);
+                }
+                if((y + 1) < image.height) {
+                    if(x > 0) {
+                        pixels[((y + 1) * image.width) + (x - 1)] += (error * 3.0f / 16.0f);
+                    }
+                    pixels[((y + 1) * image.width) + x] += (error * 5.0f / 16.0f);
+                    if((x + 1) < image.width) {
+                        pixels[((y + 1) * image.width) + (x + 1)] += (error * 1.0f / 16.0f);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void emitByte(std::vector<uint8_t>& output, const uint8_t value)
+{
+    output.push_back(value);
+}
+
+void packImage(std::vector<uint8_t>& output, const std::vector<uint8_t>& curr, const std::vector<uint8_t>* prev)
+{
+    const int max_run = PCD8544_Traits::Packed::MAX_RUN;
+    const int count   = static_cast<int>(curr.size());
+    int       end     = count;
+    int       index   = 0;
+
+    /* an unchanged tail is implied by the end marker */ {
+        if(prev != nullptr) {
+            while((end > 0) && (curr[end - 1] == (*prev)[end - 1])) {
+                --end;
+            }
+        }
+    }
+    while(index < end) {
+        /* skip unchanged bytes */ {
+            int limit = index;
+            while((prev != nullptr) && (limit < end) && ((limit - index) < max_run) && (curr[limit] == (*prev)[limit])) {
+                ++limit;
+            }
+            if(limit != index) {
+                emitByte(output, (PCD8544_Traits::Packed::SKIP | (limit - index - 1)));
+                index = limit;
+                continue;
+            }
+        }
+        /* repeat a byte */ {
+            int limit = index;
+            while((limit < end) && ((limit - index) < max_run) && (curr[limit] == curr[index])) {
+                ++limit;
+            }
+            if((limit - index) >= Traits::Packed::MIN_REPEAT) {
+                emitByte(output, (PCD8544_Traits::Packed::REPEAT | (limit - index - 1)));
+                emitByte(output, curr[index]);
+                index = limit;
+                continue;
+            }
+        }
+        /* copy literals up to the next skip or repeat */ {
+            int limit = index;
+            do {
+                ++limit;
+                if((prev != nullptr) && (limit < end) && (curr[limit] == (*prev)[limit])) {
+                    break;
+                }
+                int run = limit;
+                while((run < end) && ((run - limit) < Traits::Packed::MIN_REPEAT) && (curr[run] == curr[limit])) {
+                    ++run;
+                }
+                if((run - limit) >= Traits::Packed::MIN_REPEAT) {
+                    break;
+                }
+            } while((limit < end) && ((limit - index) < max_run));
+            emitByte(output, (PCD8544_Traits::Packed::LITERAL | (limit - index - 1)));
+            output.insert(output.end(), (curr.begin() + index), (curr.begin() + limit));
+            index = limit;
+        }
+    }
+    emitByte(output, PCD8544_Traits::Packed::END);
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// header writer
+// ---------------------------------------------------------------------------
+
+namespace {
+
+std::string makeName(const char* filename)
+{
+    const char* base = ::strrchr(filename, '/');
+    std::string name((base != nullptr) ? (base + 1) : filename);
+
+    name = name.substr(0, name.find('.'));
+    for(char& character : name) {
+        if(::isalnum(static_cast<unsigned char>(character)) == 0) {
+            character = '_';
+        }
+    }
+    if(name.empty() || (::isdigit(static_cast<unsigned char>(name[0])) != 0)) {
+        name.insert(0, "image_");
+    }
+    return name;
+}
+
+void writeBytes(FILE* stream, const std::vector<uint8_t>& bytes, const char* indent)
+{
+    const size_t count = bytes.size();
+
+    for(size_t index = 0; index < count; ++index) {
+        if((index % Traits::Output::BYTES_PER_LINE) == 0) {
+            ::fputs(indent, stream);
+        }
+        ::fprintf(stream, "0x%02x", bytes[index]);
+        if((index + 1) == count) {
+            ::fputc('\n', stream);
+        }
+        else if(((index + 1) % Traits::Output::BYTES_PER_LINE) == 0) {
+            ::fputs(",\n", stream);
+        }
+        else {
+            ::fputs(", ", stream);
+        }
+    }
+}
+
+void writeHeader(FILE* stream, const Options& options, const std::vector<Image>& images)
+{
+    const char*  name   = options.name.c_str();
+    const Image& first  = images.front();
+    const size_t frames = images.size();
+    const int    banks  = ((first.height + 7) / 8);
+
+    ::fprintf(stream, "/*\n * %s - generated by imgconv, do not edit\n */\n", name);
+    ::fprintf(stream, "#include <Arduino.h>\n\n");
+    ::fprintf(stream, "constexpr uint8_t %s_width  = %d;\n", name, first.width);
+    ::fprintf(stream, "constexpr uint8_t %s_height = %d;\n", name, first.height);
+    ::fprintf(stream, "constexpr uint8_t %s_banks  = %d;\n", name, banks);
+    ::fprintf(stream, "constexpr uint8_t %s_frames = %zu;\n\n", name, frames);
+    if(options.packed != false) {
+        std::vector<uint8_t> bytes;
+        for(size_t index = 0; index < frames; ++index) {
+            packImage(bytes, images[index].bits, (index != 0 ? &images[index - 1].bits : nullptr));
+        }
+        ::fprintf(stream, "const uint8_t %s[%zu] PROGMEM = {\n", name, bytes.size());
+        writeBytes(stream, bytes, "    ");
+        ::fprintf(stream, "};\n");
+        ::fprintf(stderr, "imgconv: %s: %zu frame(s), %zu bytes packed from %zu\n", name, frames, bytes.size(), (frames * first.bits.size()));
+    }
+    else if(frames == 1) {
+        ::fprintf(stream, "const uint8_t %s[%zu] PROGMEM = {\n", name, first.bits.size());
+        writeBytes(stream, first.bits, "    ");
+        ::fprintf(stream, "};\n");
+    }
+    else {
+        ::fprintf(stream, "const uint8_t %s[%zu][%zu] PROGMEM = {\n", name, frames, first.bits.size());
+        for(size_t index = 0; index < frames; ++index) {
+            ::fprintf(stream, "    {\n");
+            writeBytes(stream, images[index].bits, "        ");
+            ::fprintf(stream, "    }%s\n", ((index + 1) != frames ? "," : ""));
+        }
+        ::fprintf(stream, "};\n");
+    }
+}
+
+void usage(const char* program)
+{
+    ::fprintf(stderr, "usage: %s [options] image.pbm|image.pgm...\n", program);
+    ::fprintf(stderr, "    --threshold=N                 black below N, from 0 to 256 (default 128)\n");
+    ::fprintf(stderr, "    --dither=none|floyd|ordered   dithering (default none)\n");
+    ::fprintf(stderr, "    --invert                      swap black and white\n");
+    ::fprintf(stderr, "    --packed                      packed format, 84x48 images only\n");
+    ::fprintf(stderr, "    --name=NAME                   array name (default from the first input)\n");
+    ::fprintf(stderr, "    --output=FILE                 output header (default stdout)\n");
+}
+
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    Options options;
+
+    options.threshold = Traits::Default::THRESHOLD;
+    options.dither    = Traits::Default::DITHER;
+    options.invert    = false;
+    options.packed    = false;
+    options.output    = nullptr;
+
+    /* parse the command-line */ {
+        for(int argi = 1; argi < argc; ++argi) {
+            const char* arg = argv[argi];
+            if(::strncmp(arg, "--threshold=", 12) == 0) {
+                options.threshold = ::atoi(arg + 12);
+            }
+            else if(::strcmp(arg, "--dither=none") == 0) {
+                options.dither = Traits::Dither::NONE;
+            }
+            else if(::strcmp(arg, "--dither=floyd") == 0) {
+                options.dither = Traits::Dither::FLOYD;
+            }
+            else if(::strcmp(arg, "--dither=ordered") == 0) {
+                options.dither = Traits::Dither::ORDERED;
+            }
+            else if(::strcmp(arg, "--invert") == 0) {
+                options.invert = true;
+            }
+            else if(::strcmp(arg, "--packed") == 0) {
+                options.packed = true;
+            }
+            else if(::strncmp(arg, "--name=", 7) == 0) {
+                options.name = (arg + 7);
+            }
+            else if(::strncmp(arg, "--output=", 9) == 0) {
+                options.output = (arg + 9);
+            }
+            else if(arg[0] != '-') {
+                options.inputs.push_back(arg);
+            }
+            else {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        }
+        if(options.inputs.empty() || (options.threshold < 0) || (options.threshold > 256)) {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        if(options.name.empty()) {
+            options.name = makeName(options.inputs.front());
+        }
+    }
+    std::vector<Image> images(options.inputs.size());
+    /* read and convert the images */ {
+        for(size_t index = 0; index < images.size(); ++index) {
+            Image& image(images[index]);
+            if(readImage(options.inputs[index], image) == false) {
+                return EXIT_FAILURE;
+            }
+            if((image.width > PCD8544_Traits::Screen::MAX_COLS) || (image.height > (PCD8544_Traits::Screen::MAX_ROWS * 8))) {
+                ::fprintf(stderr, "imgconv: %s: larger than the screen\n", options.inputs[index]);
+                return EXIT_FAILURE;
+            }
+            if((image.width != images.front().width) || (image.height != images.front().height)) {
+                ::fprintf(stderr, "imgconv: %s: size differs from the first image\n", options.inputs[index]);
+                return EXIT_FAILURE;
+            }
+            if((options.packed != false) && ((image.width != PCD8544_Traits::Screen::MAX_COLS) || (image.height != (PCD8544_Traits::Screen::MAX_ROWS * 8)))) {
+                ::fprintf(stderr, "imgconv: %s: packed images must be full-screen\n", options.inputs[index]);
+                return EXIT_FAILURE;
+            }
+            convertImage(image, options);
+        }
+    }
+    /* write the header */ {
+        FILE* stream = stdout;
+        if(options.output != nullptr) {
+            stream = ::fopen(options.output, "w");
+            if(stream == nullptr) {
+                ::fprintf(stderr, "imgconv: %s: unable to create\n", options.output);
+                return EXIT_FAILURE;
+            }
+        }
+        writeHeader(stream, options, images);
+        if(stream != stdout) {
+            ::fclose(stream);
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------
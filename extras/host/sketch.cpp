@@ -0,0 +1,87 @@
+/*
+ * sketch.cpp - Copyright (c) 2014-2025 - Olivier Poncet
+ *
+ * This file is part of the PCD8544 library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "Arduino.h"
+#include "PCD8544_Emulator.h"
+
+// ---------------------------------------------------------------------------
+// sketch entry points
+// ---------------------------------------------------------------------------
+
+extern void setup();
+
+extern void loop();
+
+// ---------------------------------------------------------------------------
+// host wiring (same as the examples)
+// ---------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint8_t SCLK_PIN  = 2;
+constexpr uint8_t DATA_PIN  = 3;
+constexpr uint8_t MODE_PIN  = 4;
+constexpr uint8_t CSEL_PIN  = 5;
+constexpr uint8_t RESET_PIN = 6;
+
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const long loops = (argc > 1 ? ::strtol(argv[1], nullptr, 0) : 1);
+    PCD8544_Emulator emulator ( SCLK_PIN
+                              , DATA_PIN
+                              , MODE_PIN
+                              , CSEL_PIN
+                              , RESET_PIN );
+
+    /* run the sketch */ {
+        ::setup();
+        for(long count = 0; count < loops; ++count) {
+            ::loop();
+        }
+    }
+    /* dump the glass and the counters */ {
+        const PCD8544_Emulator::Counters& counters(emulator.getCounters());
+        emulator.dump(stdout);
+        ::fprintf(stdout, "commands=%lu data_bytes=%lu address_commands=%lu function_sets=%lu\n"
+                        , static_cast<unsigned long>(counters.commands)
+                        , static_cast<unsigned long>(counters.data_bytes)
+                        , static_cast<unsigned long>(counters.address_commands)
+                        , static_cast<unsigned long>(counters.function_sets));
+        ::fprintf(stdout, "sclk_edges=%lu din_edges=%lu dc_edges=%lu ce_edges=%lu rst_edges=%lu resets=%lu aborted_bytes=%lu\n"
+                        , static_cast<unsigned long>(counters.sclk_edges)
+                        , static_cast<unsigned long>(counters.din_edges)
+                        , static_cast<unsigned long>(counters.dc_edges)
+                        , static_cast<unsigned long>(counters.ce_edges)
+                        , static_cast<unsigned long>(counters.rst_edges)
+                        , static_cast<unsigned long>(counters.resets)
+                        , static_cast<unsigned long>(counters.aborted_bytes));
+    }
+    return EXIT_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// End-Of-File
+// ---------------------------------------------------------------------------